@@ -23,6 +23,8 @@ namespace UACS
 
 	Astronaut::~Astronaut() { pCoreAstr->Destroy(); FreeLibrary(coreDLL); }
 
+	void Astronaut::clbkOxygenDepleted() {}
+
 	std::string_view Astronaut::GetUACSVersion() { return pCoreAstr->GetUACSVersion(); }
 
 	size_t Astronaut::GetScnAstrCount() { return pCoreAstr->GetScnAstrCount(); }
@@ -47,4 +49,16 @@ namespace UACS
 
 	IngressResult Astronaut::TriggerAction(OBJHANDLE hVessel, std::optional<size_t> actionIdx)
 	{ return pCoreAstr->TriggerAction(hVessel, actionIdx); }
+
+	void Astronaut::DefSetStateEx(const void* status) const { VESSEL4::DefSetStateEx(status); pCoreAstr->InvalidateStatus(); }
+
+	void Astronaut::SetOxygenTank(PROPELLANT_HANDLE hOxy) { pCoreAstr->SetOxygenTank(hOxy); }
+
+	void Astronaut::SetOxygenRate(double rate) { pCoreAstr->SetOxygenRate(rate); }
+
+	double Astronaut::GetOxygenMass() { return pCoreAstr->GetOxygenMass(); }
+
+	void Astronaut::SetOxygenMass(double mass) { pCoreAstr->SetOxygenMass(mass); }
+
+	size_t Astronaut::MoveFormation(std::span<const FormationMember> members) { return pCoreAstr->MoveFormation(members); }
 }
\ No newline at end of file
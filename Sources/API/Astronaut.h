@@ -23,6 +23,15 @@ namespace UACS
 		size_t stationIdx;
 	};
 
+	struct FormationMember
+	{
+		/// The member astronaut handle.
+		OBJHANDLE hAstr;
+
+		/// The member position relative to the formation leader, where X is right and Z is forward. Y is ignored.
+		VECTOR3 offset;
+	};
+
 	struct NearestAction
 	{
 		OBJHANDLE hVessel;
@@ -52,6 +61,12 @@ namespace UACS
 		*/
 		virtual const AstrInfo* clbkGetAstrInfo() = 0;
 
+		/**
+		 * @brief The oxygen depletion callback. It's called by UACS when the oxygen set by SetOxygenTank runs out, after the consumption rate is set to zero.
+		 * @note It can be called during another astronaut's time step, as the oxygen of all astronauts is consumed together.
+		*/
+		virtual void clbkOxygenDepleted();
+
 		/**
 		 * @brief Gets UACS version.
 		 * @return UACS version.
@@ -135,6 +150,50 @@ namespace UACS
 		*/
 		IngressResult TriggerAction(OBJHANDLE hVessel = nullptr, std::optional<size_t> actionIdx = {});
 
+		/**
+		 * @brief Sets the astronaut state, and invalidates the astronaut status cached by UACS.
+		 * @note It hides VESSEL::DefSetStateEx, so astronauts should always call it instead of the VESSEL version.
+		 * @param status The new VESSELSTATUSx struct.
+		*/
+		void DefSetStateEx(const void* status) const;
+
+		/**
+		 * @brief Sets the oxygen tank consumed by UACS. The oxygen of all astronauts is consumed in one update per time step.
+		 *
+		 * The tank is written only periodically and when the oxygen runs out, so GetOxygenMass should be used instead of reading the tank.
+		 * Oxygen added to the tank by others is picked up on the next write.
+		 * @param hOxy The oxygen propellant handle. The consumption rate is reset to zero.
+		*/
+		void SetOxygenTank(PROPELLANT_HANDLE hOxy);
+
+		/**
+		 * @brief Sets the oxygen consumption rate. It should be called every time step, as the update is done by the first call in a time step.
+		 * @param rate The consumption rate in kg/s. Pass zero to stop consuming oxygen.
+		*/
+		void SetOxygenRate(double rate);
+
+		/**
+		 * @brief Gets the oxygen mass.
+		 * @return The oxygen mass in kg, or zero if SetOxygenTank wasn't called.
+		*/
+		double GetOxygenMass();
+
+		/**
+		 * @brief Sets the oxygen mass, and writes it to the oxygen tank.
+		 * @param mass The oxygen mass in kg.
+		*/
+		void SetOxygenMass(double mass);
+
+		/**
+		 * @brief Moves the formation members to their offsets from the astronaut, which leads the formation, and faces them in the astronaut heading.
+		 *
+		 * The member positions and ground orientations are computed together in one pass. It should be called after the astronaut moves.
+		 * @note Members which aren't alive astronauts landed on the same body as the astronaut are skipped. The astronaut itself must be landed.
+		 * @param members The formation members.
+		 * @return The number of members moved.
+		*/
+		size_t MoveFormation(std::span<const FormationMember> members);
+
 	private:
 		HINSTANCE coreDLL;
 		Core::Astronaut* pCoreAstr{};
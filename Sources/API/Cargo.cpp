@@ -24,6 +24,8 @@ namespace UACS
 
 	std::string_view Cargo::GetUACSVersion() { return pCoreCargo->GetUACSVersion(); }
 
+	void Cargo::DefSetStateEx(const void* status) const { VESSEL4::DefSetStateEx(status); pCoreCargo->InvalidateStatus(); }
+
 	void Cargo::clbkCargoGrappled() { }
 
 	void Cargo::clbkCargoReleased() { }
@@ -76,6 +76,13 @@ namespace UACS
 		*/
 		std::string_view GetUACSVersion();
 
+		/**
+		 * @brief Sets the cargo state, and invalidates the cargo status cached by UACS.
+		 * @note It hides VESSEL::DefSetStateEx, so cargoes should always call it instead of the VESSEL version.
+		 * @param status The new VESSELSTATUSx struct.
+		*/
+		void DefSetStateEx(const void* status) const;
+
 		/// Optional callback: Called when the cargo is grappled.
 		virtual void clbkCargoGrappled();
 
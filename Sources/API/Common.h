@@ -2,6 +2,7 @@
 #include <OrbiterAPI.h>
 #include <vector>
 #include <optional>
+#include <span>
 
 namespace UACS
 {
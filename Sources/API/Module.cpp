@@ -32,6 +32,8 @@ namespace UACS
 
 	size_t Module::GetScnAstrCount() { return pCoreModule ? pCoreModule->GetScnAstrCount() : 0; }
 
+	size_t Module::GetScnAstrGen() { return pCoreModule ? pCoreModule->GetScnAstrGen() : 0; }
+
 	std::pair<OBJHANDLE, const AstrInfo*> Module::GetAstrInfoByIndex(size_t astrIdx)
 	{ return pCoreModule ? pCoreModule->GetAstrInfoByIndex(astrIdx) : std::pair<OBJHANDLE, const AstrInfo*>{}; }
 
@@ -68,6 +70,8 @@ namespace UACS
 
 	size_t Module::GetScnCargoCount() { return pCoreModule ? pCoreModule->GetScnCargoCount() : 0; }
 
+	size_t Module::GetScnCargoGen() { return pCoreModule ? pCoreModule->GetScnCargoGen() : 0; }
+
 	CargoInfo Module::GetCargoInfoByIndex(size_t cargoIdx)
 	{ return pCoreModule ? pCoreModule->GetCargoInfoByIndex(cargoIdx) : CargoInfo(); }
 
@@ -99,6 +103,12 @@ namespace UACS
 	ReleaseResult Module::ReleaseCargo(std::optional<size_t> slotIdx)
 	{ return pCoreModule ? pCoreModule->ReleaseCargo(slotIdx) : RLES_FAIL; }
 
+	std::vector<ReleaseResult> Module::ReleaseCargoBatch(std::span<const size_t> slotIdxs)
+	{ return pCoreModule ? pCoreModule->ReleaseCargoBatch(slotIdxs) : std::vector<ReleaseResult>(slotIdxs.size(), RLES_FAIL); }
+
+	std::vector<std::pair<size_t, ReleaseResult>> Module::ReleaseAllCargo()
+	{ return pCoreModule ? pCoreModule->ReleaseAllCargo() : std::vector<std::pair<size_t, ReleaseResult>>(); }
+
 	PackResult Module::PackCargo(OBJHANDLE hCargo)
 	{ return pCoreModule ? pCoreModule->PackCargo(hCargo) : PACK_FAIL; }
 
@@ -275,6 +275,12 @@ namespace UACS
 		*/
 		size_t GetScnAstrCount();
 
+		/**
+		 * @brief Gets the scenario astronauts generation, which changes when an astronaut is added to or removed from the scenario.
+		 * @return The generation. If it's unchanged, the astronaut indices and handles are unchanged, so lists built from them can be kept.
+		*/
+		size_t GetScnAstrGen();
+
 		/**
 		 * @brief Gets an astronaut information by the astronaut index.
 		 * @param astrIdx The astronaut index. It must be less than GetScnAstrCount.
@@ -379,6 +385,12 @@ namespace UACS
 		*/
 		size_t GetScnCargoCount();
 
+		/**
+		 * @brief Gets the scenario cargoes generation, which changes when a cargo is added to or removed from the scenario.
+		 * @return The generation. If it's unchanged, the cargo indices and handles are unchanged, so lists built from them can be kept.
+		*/
+		size_t GetScnCargoGen();
+
 		/**
 		 * @brief Gets a cargo information by the cargo index.
 		 * @param cargoIdx The cargo index. It must be less than GetScnCargoCount.
@@ -463,6 +475,21 @@ namespace UACS
 		*/
 		ReleaseResult ReleaseCargo(std::optional<size_t> slotIdx = {});
 
+		/**
+		 * @brief Releases the cargoes in the passed slots.
+		 *
+		 * If the vessel is landed, the ground positions of all cargoes are planned together, so the scenario objects are scanned only once.
+		 * @param slotIdxs The slot indexes.
+		 * @return The release results, in the same order as slotIdxs.
+		*/
+		std::vector<ReleaseResult> ReleaseCargoBatch(std::span<const size_t> slotIdxs);
+
+		/**
+		 * @brief Releases the cargoes in all occupied slots. See ReleaseCargoBatch.
+		 * @return Pairs of the occupied slot index and its release result, in slot order.
+		*/
+		std::vector<std::pair<size_t, ReleaseResult>> ReleaseAllCargo();
+
 		/**
 		 * @brief Packs the passed cargo.
 		 * @param hCargo The cargo vessel handle. If nullptr is passed, the nearest packable cargo in the packing range is used.
@@ -1,7 +1,14 @@
 #pragma once
 #include <Orbitersdk.h>
+#include <charconv>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+#include <span>
 
 namespace UACS
 {
@@ -33,8 +40,136 @@ namespace UACS
 		}
 	}
 
+	// FNV-1a hash of a scenario key, so keys can be dispatched with a switch
+	constexpr uint64_t HashKey(std::string_view key)
+	{
+		uint64_t hash = 14695981039346656037ull;
+
+		for (char c : key) { hash ^= uint8_t(c); hash *= 1099511628211ull; }
+
+		return hash;
+	}
+
+	// Splits a scenario line into whitespace-separated tokens without copying it
+	class ScenarioLine
+	{
+	public:
+		explicit ScenarioLine(std::string_view line) : rest(line) {}
+
+		// Returns an empty view if no token is left
+		std::string_view Next()
+		{
+			const size_t start = rest.find_first_not_of(" \t\r\n");
+
+			if (start == std::string_view::npos) { rest = {}; return {}; }
+
+			const size_t end = min(rest.find_first_of(" \t\r\n", start), rest.size());
+			const std::string_view token = rest.substr(start, end - start);
+
+			rest.remove_prefix(end);
+
+			return token;
+		}
+
+		// Returns the rest of the line without leading and trailing whitespace
+		std::string_view Rest()
+		{
+			const size_t start = rest.find_first_not_of(" \t\r\n");
+
+			if (start == std::string_view::npos) { rest = {}; return {}; }
+
+			const std::string_view line = rest.substr(start, rest.find_last_not_of(" \t\r\n") + 1 - start);
+			rest = {};
+
+			return line;
+		}
+
+		// Reads the next token. Numbers are parsed with from_chars, and flags are read as numbers like stream extraction does
+		template<typename T>
+		bool Read(T& value)
+		{
+			const std::string_view token = Next();
+
+			if (token.empty()) return false;
+
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				int flag{};
+				if (std::from_chars(token.data(), token.data() + token.size(), flag).ec != std::errc()) return false;
+
+				value = flag;
+			}
+
+			else if constexpr (std::is_arithmetic_v<T>) { if (std::from_chars(token.data(), token.data() + token.size(), value).ec != std::errc()) return false; }
+
+			else value = token;
+
+			return true;
+		}
+
+		// Reads the next field written by AppendQuoted, without its quotes and escapes
+		bool ReadQuoted(std::string& value)
+		{
+			const size_t start = rest.find_first_not_of(" \t\r\n");
+
+			if (start == std::string_view::npos || rest[start] != '"') return false;
+
+			value.clear();
+
+			for (size_t idx = start + 1; idx < rest.size(); ++idx)
+			{
+				char c = rest[idx];
+
+				if (c == '"') { rest.remove_prefix(idx + 1); return true; }
+
+				if (c == '\\' && idx + 1 < rest.size()) c = rest[++idx];
+
+				value.push_back(c);
+			}
+
+			rest = {};
+
+			return false;
+		}
+
+	private:
+		std::string_view rest;
+	};
+
+	// Appends a field in quotes, escaping quotes and backslashes, so it can be empty or contain spaces
+	inline void AppendQuoted(std::string& line, std::string_view value)
+	{
+		line += " \"";
+
+		for (char c : value)
+		{
+			if (c == '"' || c == '\\') line += '\\';
+			line += c;
+		}
+
+		line += '"';
+	}
+
+	/*
+	 * Offsets smaller than tangentMaxAngle (offset / body radius), below tangentMaxLat, are computed on the local
+	 * east-north tangent plane. The position error is at most s * (s / R) * (1 + tan|lat|) for an offset s on a body
+	 * of radius R: about 0.4 mm for a 10 m offset on the Moon at 80 degrees, and nothing measurable near the equator.
+	*/
+	inline const double tangentMaxAngle = 1e-5;
+	inline const double tangentMaxLat = 80 * RAD;
+
+	inline bool UseTangentPlane(double angle, double lat) { return abs(angle) < tangentMaxAngle && abs(lat) < tangentMaxLat; }
+
 	inline double DistLngLat(double bodySize, double lng1, double lat1, double lng2, double lat2)
 	{
+		if (UseTangentPlane(abs(lat2 - lat1) + abs(lng2 - lng1), lat1))
+		{
+			const double east = (lng2 - lng1) * cos((lat1 + lat2) * 0.5);
+			const double north = lat2 - lat1;
+
+			return sqrt(east * east + north * north) * bodySize;
+		}
+
 		double latOffset = (lat2 - lat1) * 0.5;
 		double lngOffset = (lng2 - lng1) * 0.5;
 
@@ -44,6 +179,172 @@ namespace UACS
 		return c * bodySize;
 	}
 
+	// Converts a vessel-relative horizontal position to longitude and latitude
+	inline std::pair<double, double> Local2LngLat(double bodySize, double lng, double lat, double hdg, VECTOR3 pos)
+	{
+		double dist = length(pos) / bodySize;
+
+		if (UseTangentPlane(dist, lat))
+		{
+			const double sinHdg = sin(hdg), cosHdg = cos(hdg);
+
+			const double east = (pos.z * sinHdg + pos.x * cosHdg) / bodySize;
+			const double north = (pos.z * cosHdg - pos.x * sinHdg) / bodySize;
+
+			return { lng + east / cos(lat), lat + north };
+		}
+
+		double finalHdg = fmod(atan2(pos.x, pos.z) + PI2 + hdg, PI2);
+
+		double finalLat = asin(sin(lat) * cos(dist) + cos(lat) * sin(dist) * cos(finalHdg));
+		double finalLng = atan2(sin(finalHdg) * sin(dist) * cos(lat), cos(dist) - sin(lat) * sin(finalLat)) + lng;
+
+		return { finalLng, finalLat };
+	}
+
+	// Batch version of Local2LngLat, for positions relative to the same coordinates and heading
+	inline void Local2LngLat(double bodySize, double lng, double lat, double hdg, std::span<const VECTOR3> positions, std::span<std::pair<double, double>> coords)
+	{
+		const size_t count = min(positions.size(), coords.size());
+		const double sinHdg = sin(hdg), cosHdg = cos(hdg), cosLat = cos(lat);
+
+		for (size_t idx{}; idx < count; ++idx)
+		{
+			const VECTOR3& pos = positions[idx];
+
+			if (!UseTangentPlane(length(pos) / bodySize, lat)) { coords[idx] = Local2LngLat(bodySize, lng, lat, hdg, pos); continue; }
+
+			const double east = (pos.z * sinHdg + pos.x * cosHdg) / bodySize;
+			const double north = (pos.z * cosHdg - pos.x * sinHdg) / bodySize;
+
+			coords[idx] = { lng + east / cosLat, lat + north };
+		}
+	}
+
+	// Converts longitude and latitude to a horizontal position relative to the passed coordinates and heading
+	inline VECTOR3 LngLat2Local(double bodySize, double lng, double lat, double hdg, double tgtLng, double tgtLat)
+	{
+		const double lngOffset = tgtLng - lng;
+		const double sinHdg = sin(hdg), cosHdg = cos(hdg);
+
+		if (UseTangentPlane(abs(tgtLat - lat) + abs(lngOffset), lat))
+		{
+			const double east = lngOffset * cos(lat) * bodySize;
+			const double north = (tgtLat - lat) * bodySize;
+
+			return { east * cosHdg - north * sinHdg, 0, east * sinHdg + north * cosHdg };
+		}
+
+		const double dist = DistLngLat(bodySize, lng, lat, tgtLng, tgtLat);
+		const double bearing = atan2(sin(lngOffset) * cos(tgtLat), cos(lat) * sin(tgtLat) - sin(lat) * cos(tgtLat) * cos(lngOffset));
+
+		// Rotate the bearing vector by the heading
+		return { dist * (sin(bearing) * cosHdg - cos(bearing) * sinHdg), 0, dist * (cos(bearing) * cosHdg + sin(bearing) * sinHdg) };
+	}
+
+	/*
+	 * Terrain elevation samples, quantized to elevQuantum meters, which is well below the finest elevation tile resolution.
+	 * Each sample keeps the tile level it was read from. Once a finer level is seen on the same body, coarser samples are read again,
+	 * so higher resolution tiles loaded later are picked up. When the cache is full, the least recently used samples are replaced (clock).
+	*/
+	inline const double elevQuantum = 0.05;
+	inline const size_t elevCacheSize = 4096;
+
+	struct ElevKey
+	{
+		OBJHANDLE hBody;
+		long long lng, lat;
+
+		bool operator==(const ElevKey&) const = default;
+	};
+
+	struct ElevKeyHash
+	{
+		size_t operator()(const ElevKey& key) const
+		{ return std::hash<OBJHANDLE>{}(key.hBody) ^ (std::hash<long long>{}(key.lng) * 31 + std::hash<long long>{}(key.lat)); }
+	};
+
+	class ElevationCache
+	{
+	public:
+		explicit ElevationCache(size_t capacity) : capacity(max(capacity, size_t(1))) { slots.reserve(this->capacity); }
+
+		double Get(OBJHANDLE hBody, double bodySize, double lng, double lat)
+		{
+			const ElevKey key{ hBody, llround(lng * bodySize / elevQuantum), llround(lat * bodySize / elevQuantum) };
+
+			auto slotIt = slotMap.find(key);
+
+			if (slotIt == slotMap.end())
+			{
+				const size_t slotIdx = NextSlot();
+
+				slotIt = slotMap.emplace(key, slotIdx).first;
+				slots[slotIdx].key = key;
+
+				Read(slots[slotIdx], lng, lat);
+
+				return slots[slotIdx].elev;
+			}
+
+			Slot& slot = slots[slotIt->second];
+			slot.used = true;
+
+			// Read the sample again if a finer level was seen on its body since it was last read
+			if (slot.checkedLevel < bodyLevels[hBody]) Read(slot, lng, lat);
+
+			return slot.elev;
+		}
+
+		size_t Size() const { return slotMap.size(); }
+
+	private:
+		struct Slot
+		{
+			ElevKey key;
+			double elev;
+			int checkedLevel;
+			bool used;
+		};
+
+		size_t capacity;
+		std::vector<Slot> slots;
+		std::unordered_map<ElevKey, size_t, ElevKeyHash> slotMap;
+		std::unordered_map<OBJHANDLE, int> bodyLevels;
+		size_t hand{};
+
+		void Read(Slot& slot, double lng, double lat)
+		{
+			int level{};
+			slot.elev = oapiSurfaceElevationEx(slot.key.hBody, lng, lat, 0, nullptr, nullptr, &level);
+			slot.used = true;
+
+			int& bodyLevel = bodyLevels[slot.key.hBody];
+			bodyLevel = max(bodyLevel, level);
+
+			slot.checkedLevel = bodyLevel;
+		}
+
+		size_t NextSlot()
+		{
+			if (slots.size() < capacity) { slots.emplace_back(); return slots.size() - 1; }
+
+			// Skip the slots used since the hand last passed them, clearing their flag
+			while (slots[hand].used) { slots[hand].used = false; hand = (hand + 1) % capacity; }
+
+			const size_t slotIdx = hand;
+			hand = (hand + 1) % capacity;
+
+			slotMap.erase(slots[slotIdx].key);
+
+			return slotIdx;
+		}
+	};
+
+	inline ElevationCache elevCache(elevCacheSize);
+
+	inline double GetSurfaceElevation(OBJHANDLE hBody, double bodySize, double lng, double lat) { return elevCache.Get(hBody, bodySize, lng, lat); }
+
 	inline MATRIX3 RotationMatrix(VECTOR3 angles)
 	{
 		const MATRIX3 RM_X = _M(1, 0, 0, 0, cos(angles.x), -sin(angles.x), 0, sin(angles.x), cos(angles.x));
@@ -53,17 +354,41 @@ namespace UACS
 		return mul(RM_X, mul(RM_Y, RM_Z));
 	}
 
-	inline void SetGroundRotation(VESSELSTATUS2& status, double height)
+	/*
+	 * Closed form of RotationMatrix({ 0, PI05 - lng, 0 }) * RotationMatrix({ -lat, 0, 0 }) * RotationMatrix({ 0, 0, PI + hdg }) * RotationMatrix({ tilt, 0, roll }).
+	 * Only the entries used by the Euler angles are computed, from one sine and cosine of each angle.
+	*/
+	inline void SetGroundArot(VESSELSTATUS2& status, double tilt, double roll)
 	{
-		const MATRIX3 rot1 = RotationMatrix({ 0, PI05 - status.surf_lng, 0 });
-		const MATRIX3 rot2 = RotationMatrix({ -status.surf_lat, 0, 0 });
-		const MATRIX3 rot3 = RotationMatrix({ 0, 0, PI + status.surf_hdg });
-		const MATRIX3 rot4 = RotationMatrix({ PI05, 0, 0 });
-		const MATRIX3 RotMatrix_Def = mul(rot1, mul(rot2, mul(rot3, rot4)));
+		const double sinLng = sin(status.surf_lng), cosLng = cos(status.surf_lng);
+		const double sinLat = sin(status.surf_lat), cosLat = cos(status.surf_lat);
+		const double sinHdg = sin(status.surf_hdg), cosHdg = cos(status.surf_hdg);
+		const double sinTilt = sin(tilt), cosTilt = cos(tilt);
+		const double sinRoll = sin(roll), cosRoll = cos(roll);
+
+		// Surface frame entries (the first three matrices)
+		const double a11 = cosLng * sinLat * sinHdg - sinLng * cosHdg;
+		const double a12 = sinLng * sinHdg + cosLng * sinLat * cosHdg;
+		const double a13 = cosLng * cosLat;
+		const double a22 = -cosLat * cosHdg;
+		const double a23 = sinLat;
+		const double a32 = sinLng * sinLat * cosHdg - cosLng * sinHdg;
+		const double a33 = sinLng * cosLat;
 
-		status.arot.x = atan2(RotMatrix_Def.m23, RotMatrix_Def.m33);
-		status.arot.y = -asin(RotMatrix_Def.m13);
-		status.arot.z = atan2(RotMatrix_Def.m12, RotMatrix_Def.m11);
+		const double m11 = a11 * cosRoll + (a12 * cosTilt + a13 * sinTilt) * sinRoll;
+		const double m12 = -a11 * sinRoll + (a12 * cosTilt + a13 * sinTilt) * cosRoll;
+		const double m13 = a13 * cosTilt - a12 * sinTilt;
+		const double m23 = a23 * cosTilt - a22 * sinTilt;
+		const double m33 = a33 * cosTilt - a32 * sinTilt;
+
+		status.arot.x = atan2(m23, m33);
+		status.arot.y = -asin(m13);
+		status.arot.z = atan2(m12, m11);
+	}
+
+	inline void SetGroundRotation(VESSELSTATUS2& status, double height)
+	{
+		SetGroundArot(status, PI05, 0);
 
 		status.vrot.x = height;
 	}
@@ -110,29 +435,80 @@ namespace UACS
 
 		const double frontLng = (frontPos.z * sin(status.surf_hdg)) / bodySize;
 		const double frontLat = (frontPos.z * cos(status.surf_hdg)) / bodySize;
-		const double frontElev = oapiSurfaceElevation(status.rbody, status.surf_lng + frontLng, status.surf_lat + frontLat);
+		const double frontElev = GetSurfaceElevation(status.rbody, bodySize, status.surf_lng + frontLng, status.surf_lat + frontLat);
 
 		const double rightLng = (rightPos->z * sin(status.surf_hdg) + rightPos->x * cos(status.surf_hdg)) / bodySize;
 		const double rightLat = (rightPos->z * cos(status.surf_hdg) - rightPos->x * sin(status.surf_hdg)) / bodySize;
-		const double rightElev = oapiSurfaceElevation(status.rbody, status.surf_lng + rightLng, status.surf_lat + rightLat);
+		const double rightElev = GetSurfaceElevation(status.rbody, bodySize, status.surf_lng + rightLng, status.surf_lat + rightLat);
 
 		const double leftLng = (leftPos->z * sin(status.surf_hdg) + leftPos->x * cos(status.surf_hdg)) / bodySize;
 		const double leftLat = (leftPos->z * cos(status.surf_hdg) - leftPos->x * sin(status.surf_hdg)) / bodySize;
-		const double leftElev = oapiSurfaceElevation(status.rbody, status.surf_lng + leftLng, status.surf_lat + leftLat);
+		const double leftElev = GetSurfaceElevation(status.rbody, bodySize, status.surf_lng + leftLng, status.surf_lat + leftLat);
 
 		const double pitchAngle = atan2(((rightElev + leftElev) * 0.5) - frontElev, rightPos->z - frontPos.z);
 		const double rollAngle = -atan2(leftElev - rightElev, leftPos->x - rightPos->x);
 
-		const MATRIX3 rot1 = RotationMatrix({ 0, PI05 - status.surf_lng, 0 });
-		const MATRIX3 rot2 = RotationMatrix({ -status.surf_lat, 0, 0 });
-		const MATRIX3 rot3 = RotationMatrix({ 0, 0, PI + status.surf_hdg });
-		const MATRIX3 rot4 = RotationMatrix({ rotAngle - pitchAngle, 0, rollAngle });
-		const MATRIX3 RotMatrix_Def = mul(rot1, mul(rot2, mul(rot3, rot4)));
-
-		status.arot.x = atan2(RotMatrix_Def.m23, RotMatrix_Def.m33);
-		status.arot.y = -asin(RotMatrix_Def.m13);
-		status.arot.z = atan2(RotMatrix_Def.m12, RotMatrix_Def.m11);
+		SetGroundArot(status, rotAngle - pitchAngle, rollAngle);
 
 		status.vrot.x = abs(frontPos.y);
 	}
+
+	struct TouchdownInfo
+	{
+		VECTOR3 frontPos;
+		std::optional<VECTOR3> rightPos;
+		std::optional<VECTOR3> leftPos;
+	};
+
+	// Batch version of the sloped ground SetGroundRotation. Position offsets must be already added to the statuses
+	inline void SetGroundRotation(std::span<VESSELSTATUS2> statuses, std::span<const TouchdownInfo> tdInfos, double rotAngle = PI05)
+	{
+		const size_t count = min(statuses.size(), tdInfos.size());
+
+		// Front, right and left elevations of each status, all sampled before the orientation loop
+		std::vector<double> elevs(3 * count);
+
+		OBJHANDLE hBody{};
+		double bodySize{};
+
+		for (size_t idx{}; idx < count; ++idx)
+		{
+			const VESSELSTATUS2& status = statuses[idx];
+			const TouchdownInfo& tdInfo = tdInfos[idx];
+
+			if (!tdInfo.rightPos || !tdInfo.leftPos) continue;
+
+			if (status.rbody != hBody) { hBody = status.rbody; bodySize = oapiGetSize(hBody); }
+
+			const double sinHdg = sin(status.surf_hdg), cosHdg = cos(status.surf_hdg);
+
+			auto sample = [&](const VECTOR3& pos)
+			{
+				return GetSurfaceElevation(hBody, bodySize, status.surf_lng + (pos.z * sinHdg + pos.x * cosHdg) / bodySize,
+					status.surf_lat + (pos.z * cosHdg - pos.x * sinHdg) / bodySize);
+			};
+
+			// The single version ignores the front X offset, so it is ignored here too
+			elevs[3 * idx] = sample({ 0, 0, tdInfo.frontPos.z });
+			elevs[3 * idx + 1] = sample(*tdInfo.rightPos);
+			elevs[3 * idx + 2] = sample(*tdInfo.leftPos);
+		}
+
+		for (size_t idx{}; idx < count; ++idx)
+		{
+			VESSELSTATUS2& status = statuses[idx];
+			const TouchdownInfo& tdInfo = tdInfos[idx];
+
+			status.vrot.x = abs(tdInfo.frontPos.y);
+
+			if (!tdInfo.rightPos || !tdInfo.leftPos) { SetGroundArot(status, PI05, 0); continue; }
+
+			const double frontElev = elevs[3 * idx], rightElev = elevs[3 * idx + 1], leftElev = elevs[3 * idx + 2];
+
+			const double pitchAngle = atan2(((rightElev + leftElev) * 0.5) - frontElev, tdInfo.rightPos->z - tdInfo.frontPos.z);
+			const double rollAngle = -atan2(leftElev - rightElev, tdInfo.leftPos->x - tdInfo.rightPos->x);
+
+			SetGroundArot(status, rotAngle - pitchAngle, rollAngle);
+		}
+	}
 }
\ No newline at end of file
@@ -8,11 +8,15 @@ namespace UACS
 {
 	namespace Core
 	{
-		Astronaut::Astronaut(UACS::Astronaut* pAstr) : pAstr(pAstr) { astrVector.push_back(pAstr); }
+		Astronaut::Astronaut(UACS::Astronaut* pAstr) : pAstr(pAstr) { astrVector.push_back(pAstr); ++astrGen; }
 
 		void Astronaut::Destroy() noexcept
 		{
 			std::erase(astrVector, pAstr);
+			++astrGen;
+			std::erase_if(lifeSupports, [this](const LifeSupport& lifeSupport) { return lifeSupport.pAstr == pAstr; });
+			Core::InvalidateStatus(pAstr->GetHandle());
+			FreeGroundCells(pAstr->GetHandle());
 			delete this;
 		}
 
@@ -206,13 +210,54 @@ namespace UACS
 				if (temp > 223 && temp < 373 && pressure > 3.6e4 && pressure < 2.5e5) return true;
 			}
 
+			if (InCachedBreathable()) return true;
+
 			passCheck = true;
 			auto result = GetNearestBreathable(0);
 			passCheck = false;
 
+			hBreathable = result.first;
+			breathableGen = Core::breathableGen;
+
+			// Cargoes are only deleted with breathableGen incremented, so the pointer is valid as long as the cache is
+			auto cargoIt = std::ranges::find_if(cargoVector, [this](UACS::Cargo* pCargo) { return pCargo->GetHandle() == hBreathable; });
+			pBreathableCargo = (cargoIt == cargoVector.end()) ? nullptr : *cargoIt;
+
 			return result.first;
 		}
 
+		bool Astronaut::InCachedBreathable()
+		{
+			if (!hBreathable || breathableGen != Core::breathableGen || !oapiIsVessel(hBreathable)) return false;
+
+			VESSEL* pVessel = oapiGetVesselInterface(hBreathable);
+
+			// Breathable cargoes can be packed since they were cached
+			if (pBreathableCargo)
+			{
+				auto cargoInfo = pBreathableCargo->clbkGetCargoInfo();
+
+				if (!cargoInfo->breathable || !cargoInfo->unpacked) return false;
+			}
+
+			// Other vessels are breathable through their last attachment, which can be changed since they were cached
+			else
+			{
+				const int attachIdx = int(pVessel->AttachmentCount(true)) - 1;
+
+				if (attachIdx < 0) return false;
+
+				const char* attachLabel = pVessel->GetAttachmentId(pVessel->GetAttachmentHandle(true, attachIdx));
+
+				if (!attachLabel || (std::strcmp(attachLabel, "UACS_B") && std::strcmp(attachLabel, "UACS_RB"))) return false;
+			}
+
+			VECTOR3 relPos;
+			pAstr->GetRelativePos(hBreathable, relPos);
+
+			return length(relPos) <= pVessel->GetSize();
+		}
+
 		IngressResult Astronaut::Ingress(OBJHANDLE hVessel, std::optional<size_t> airlockIdx, std::optional<size_t> stationIdx)
 		{
 			if (hVessel)
@@ -337,5 +382,121 @@ namespace UACS
 
 			return INGRS_SUCCED;
 		}
+
+		void Astronaut::InvalidateStatus() { Core::InvalidateStatus(pAstr->GetHandle()); }
+
+		void Astronaut::SetOxygenTank(PROPELLANT_HANDLE hOxy)
+		{
+			const double mass = pAstr->GetPropellantMass(hOxy);
+
+			if (LifeSupport* pLifeSupport = GetLifeSupport()) *pLifeSupport = { pAstr, hOxy, 0, mass, mass };
+			else
+			{
+				lifeSupportIdx = lifeSupports.size();
+				lifeSupports.push_back({ pAstr, hOxy, 0, mass, mass });
+			}
+		}
+
+		void Astronaut::SetOxygenRate(double rate)
+		{
+			// The first call in a step consumes the oxygen of all astronauts, with the rates set in the previous step
+			UpdateLifeSupport();
+
+			if (LifeSupport* pLifeSupport = GetLifeSupport()) pLifeSupport->rate = rate;
+		}
+
+		double Astronaut::GetOxygenMass()
+		{
+			LifeSupport* pLifeSupport = GetLifeSupport();
+
+			if (!pLifeSupport) return 0;
+
+			// Includes the oxygen used since the last update, which is done by the next SetOxygenRate call
+			return max(pLifeSupport->mass - pLifeSupport->rate * (oapiGetSimTime() - lifeSupportSimt), 0);
+		}
+
+		void Astronaut::SetOxygenMass(double mass)
+		{
+			UpdateLifeSupport();
+
+			LifeSupport* pLifeSupport = GetLifeSupport();
+
+			if (!pLifeSupport) return;
+
+			pLifeSupport->mass = pLifeSupport->tankMass = mass;
+			pAstr->SetPropellantMass(pLifeSupport->hOxy, mass);
+		}
+
+		size_t Astronaut::MoveFormation(std::span<const FormationMember> members)
+		{
+			const VESSELSTATUS2& leadStatus = GetCachedStatus(pAstr);
+
+			if (!leadStatus.status) return 0;
+
+			std::vector<UACS::Astronaut*> followers;
+			std::vector<VECTOR3> offsets;
+
+			followers.reserve(members.size());
+			offsets.reserve(members.size());
+
+			for (const FormationMember& member : members)
+			{
+				auto astrIt = std::ranges::find_if(astrVector, [&member](UACS::Astronaut* pAstr) { return pAstr->GetHandle() == member.hAstr; });
+
+				if (astrIt == astrVector.end() || *astrIt == pAstr || !(*astrIt)->clbkGetAstrInfo()->alive) continue;
+
+				const VESSELSTATUS2& status = GetCachedStatus(*astrIt);
+
+				if (!status.status || status.rbody != leadStatus.rbody) continue;
+
+				followers.push_back(*astrIt);
+				offsets.push_back({ member.offset.x, 0, member.offset.z });
+			}
+
+			std::vector<std::pair<double, double>> coords(followers.size());
+
+			Local2LngLat(oapiGetSize(leadStatus.rbody), leadStatus.surf_lng, leadStatus.surf_lat, leadStatus.surf_hdg, offsets, coords);
+
+			std::vector<VESSELSTATUS2> statuses;
+			std::vector<TouchdownInfo> tdInfos;
+
+			statuses.reserve(followers.size());
+			tdInfos.reserve(followers.size());
+
+			for (size_t idx{}; idx < followers.size(); ++idx)
+			{
+				VESSELSTATUS2 status = GetCachedStatus(followers[idx]);
+
+				status.surf_lng = coords[idx].first;
+				status.surf_lat = coords[idx].second;
+				status.surf_hdg = leadStatus.surf_hdg;
+
+				statuses.push_back(status);
+				tdInfos.push_back({ { 0, -followers[idx]->clbkGetAstrInfo()->height, 0 } });
+			}
+
+			SetGroundRotation(statuses, tdInfos);
+
+			for (size_t idx{}; idx < followers.size(); ++idx)
+			{
+				// The API version isn't linked to the core, so the status is invalidated here
+				followers[idx]->VESSEL4::DefSetStateEx(&statuses[idx]);
+				Core::InvalidateStatus(followers[idx]->GetHandle());
+			}
+
+			return followers.size();
+		}
+
+		LifeSupport* Astronaut::GetLifeSupport()
+		{
+			if (lifeSupportIdx < lifeSupports.size() && lifeSupports[lifeSupportIdx].pAstr == pAstr) return &lifeSupports[lifeSupportIdx];
+
+			auto lsIt = std::ranges::find(lifeSupports, pAstr, &LifeSupport::pAstr);
+
+			if (lsIt == lifeSupports.end()) return nullptr;
+
+			lifeSupportIdx = lsIt - lifeSupports.begin();
+			return &(*lsIt);
+		}
 	}
 }
\ No newline at end of file
@@ -4,8 +4,12 @@
 
 namespace UACS
 {
+	class Cargo;
+
 	namespace Core
 	{
+		struct LifeSupport;
+
 		class Astronaut
 		{
 		public:
@@ -34,9 +38,31 @@ namespace UACS
 
 			virtual IngressResult TriggerAction(OBJHANDLE, std::optional<size_t>);
 
+			virtual void InvalidateStatus();
+
+			virtual void SetOxygenTank(PROPELLANT_HANDLE);
+
+			virtual void SetOxygenRate(double);
+
+			virtual double GetOxygenMass();
+
+			virtual void SetOxygenMass(double);
+
+			virtual size_t MoveFormation(std::span<const FormationMember>);
+
 		private:
 			UACS::Astronaut* pAstr;
 			bool passCheck{};
+
+			// The breathable vessel the astronaut was last found in, which is checked before searching all vessels
+			OBJHANDLE hBreathable{};
+			UACS::Cargo* pBreathableCargo{};
+			size_t breathableGen{};
+			bool InCachedBreathable();
+
+			// Last known index in lifeSupports, which shifts as other astronauts are destroyed
+			size_t lifeSupportIdx{};
+			LifeSupport* GetLifeSupport();
 		};
 	}
 }
\ No newline at end of file
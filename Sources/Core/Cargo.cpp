@@ -6,14 +6,20 @@ namespace UACS
 {
 	namespace Core
 	{
-		Cargo::Cargo(UACS::Cargo* pCargo) : pCargo(pCargo) { cargoVector.push_back(pCargo); }
+		Cargo::Cargo(UACS::Cargo* pCargo) : pCargo(pCargo) { cargoVector.push_back(pCargo); ++cargoGen; }
 
 		void Cargo::Destroy() noexcept
 		{
 			std::erase(cargoVector, pCargo);
+			++cargoGen;
+			Core::InvalidateStatus(pCargo->GetHandle());
+			FreeGroundCells(pCargo->GetHandle());
+			++breathableGen;
 			delete this;
 		}
 
 		std::string_view Cargo::GetUACSVersion() { return Core::GetUACSVersion(); }
+
+		void Cargo::InvalidateStatus() { Core::InvalidateStatus(pCargo->GetHandle()); }
 	}
 }
\ No newline at end of file
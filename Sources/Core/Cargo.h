@@ -13,6 +13,8 @@ namespace UACS
 
 			virtual std::string_view GetUACSVersion();
 
+			virtual void InvalidateStatus();
+
 		private:
 			UACS::Cargo* pCargo;
 		};
@@ -1,7 +1,9 @@
 #pragma once
 #include "Defs.h"
+#include "..\BaseCommon.h"
 
 #include <unordered_map>
+#include <unordered_set>
 #include <span>
 
 namespace UACS
@@ -14,6 +16,25 @@ namespace UACS
 
 		inline std::unordered_map<OBJHANDLE, UACS::VslAstrInfo*> vslAstrMap;
 
+		inline std::unordered_set<std::string> preloadedAstrClasses;
+
+		// Incremented when a cargo is deleted, so breathable vessels cached by astronauts are searched again
+		inline size_t breathableGen{};
+
+		// Incremented when an astronaut or a cargo is added to or removed from the scenario
+		inline size_t astrGen{}, cargoGen{};
+
+		struct CachedStatus
+		{
+			double simt;
+			VESSELSTATUS2 status;
+		};
+
+		inline std::unordered_map<OBJHANDLE, CachedStatus> statusCache;
+
+		// Ground object positions below this count are computed on the calling thread, as spawning the parallel tasks costs more
+		inline const size_t parGeodesyMinCount = 512;
+
 		inline std::string_view GetUACSVersion() { return "1.0.0"; }
 
 		inline std::pair<OBJHANDLE, const UACS::AstrInfo*> GetAstrInfoByIndex(size_t astrIdx)
@@ -36,6 +57,89 @@ namespace UACS
 			return (vslPair == vslAstrMap.end()) ? nullptr : vslPair->second;
 		}
 
+		// Returns the vessel status, fetched at most once per simulation step unless invalidated
+		inline const VESSELSTATUS2& GetCachedStatus(const VESSEL* pVessel)
+		{
+			const double simt = oapiGetSimTime();
+
+			auto [cacheIt, inserted] = statusCache.try_emplace(pVessel->GetHandle());
+
+			if (inserted || cacheIt->second.simt != simt) cacheIt->second = { simt, GetVesselStatus(pVessel) };
+
+			return cacheIt->second.status;
+		}
+
+		inline void InvalidateStatus(OBJHANDLE hVessel) { statusCache.erase(hVessel); }
+
+		// Oxygen state of an astronaut. The tank is only written every lifeSupportSyncInterval seconds of real time, or when running out.
+		struct LifeSupport
+		{
+			UACS::Astronaut* pAstr;
+			PROPELLANT_HANDLE hOxy;
+			double rate;
+			double mass;
+			double tankMass;
+		};
+
+		inline std::vector<LifeSupport> lifeSupports;
+		inline std::vector<UACS::Astronaut*> depletedAstrs;
+
+		inline const double lifeSupportSyncInterval = 1;
+		inline double lifeSupportSimt{}, lifeSupportSyncTime{};
+
+		inline void SyncOxygenTank(LifeSupport& lifeSupport)
+		{
+			// The tank mass differs from tankMass only if it was changed by others since the last write
+			lifeSupport.mass = max(lifeSupport.mass + lifeSupport.pAstr->GetPropellantMass(lifeSupport.hOxy) - lifeSupport.tankMass, 0);
+			lifeSupport.tankMass = lifeSupport.mass;
+
+			lifeSupport.pAstr->SetPropellantMass(lifeSupport.hOxy, lifeSupport.mass);
+		}
+
+		// Consumes the oxygen of all astronauts, at most once per simulation step
+		inline void UpdateLifeSupport()
+		{
+			const double simt = oapiGetSimTime();
+			const double dt = simt - lifeSupportSimt;
+
+			lifeSupportSimt = simt;
+
+			if (dt <= 0) return;
+
+			const bool syncTanks = oapiGetSysTime() - lifeSupportSyncTime >= lifeSupportSyncInterval;
+
+			if (syncTanks) lifeSupportSyncTime = oapiGetSysTime();
+
+			for (LifeSupport& lifeSupport : lifeSupports)
+			{
+				if (!lifeSupport.rate) continue;
+
+				const double usage = lifeSupport.rate * dt;
+
+				// Oxygen may have been added since the last write, so the tank is checked before running out
+				if (usage >= lifeSupport.mass) SyncOxygenTank(lifeSupport);
+
+				if (usage < lifeSupport.mass)
+				{
+					lifeSupport.mass -= usage;
+
+					if (syncTanks) SyncOxygenTank(lifeSupport);
+
+					continue;
+				}
+
+				lifeSupport.rate = lifeSupport.mass = lifeSupport.tankMass = 0;
+				lifeSupport.pAstr->SetPropellantMass(lifeSupport.hOxy, 0);
+
+				depletedAstrs.push_back(lifeSupport.pAstr);
+			}
+
+			// Called after the loop, as the astronauts can change their life support in the callback
+			for (UACS::Astronaut* pAstr : depletedAstrs) pAstr->clbkOxygenDepleted();
+
+			depletedAstrs.clear();
+		}
+
 		inline size_t GetEmptyStationIndex(std::span<const UACS::StationInfo> stations)
 		{
 			for (size_t idx{}; idx < stations.size(); ++idx) if (!stations[idx].astrInfo) return idx;
@@ -0,0 +1,85 @@
+#pragma once
+#include <Orbitersdk.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace UACS
+{
+	namespace Core
+	{
+		class GroundTable;
+
+		// All the module ground tables, so the cells of grappled or deleted objects can be freed
+		inline std::vector<GroundTable*> groundTables;
+
+		// Ground cells of a release grid and the objects reserving them
+		class GroundTable
+		{
+		public:
+			OBJHANDLE hBody{};
+			double lng{}, lat{}, hdg{};
+			VECTOR3 initPos{}, rowStep{}, colStep{};
+			size_t colCount{};
+
+			GroundTable() { groundTables.push_back(this); }
+			~GroundTable() { std::erase(groundTables, this); }
+
+			GroundTable(const GroundTable&) = delete;
+			GroundTable& operator=(const GroundTable&) = delete;
+
+			void Reset(size_t cellCount)
+			{
+				cells.assign(cellCount, nullptr);
+				objCells.clear();
+			}
+
+			size_t Size() const { return cells.size(); }
+
+			bool IsFree(size_t cellIdx) const { return !cells[cellIdx]; }
+
+			// Returns the object reserving the cell, or nullptr if it's free
+			OBJHANDLE Holder(size_t cellIdx) const { return cells[cellIdx]; }
+
+			void Reserve(size_t cellIdx, OBJHANDLE hObj)
+			{
+				if (!hObj || cells[cellIdx]) return;
+
+				cells[cellIdx] = hObj;
+				objCells[hObj].push_back(cellIdx);
+			}
+
+			// Frees a single cell, such as one whose object moved away from it
+			void FreeCell(size_t cellIdx)
+			{
+				auto objIt = objCells.find(cells[cellIdx]);
+
+				cells[cellIdx] = nullptr;
+
+				if (objIt == objCells.end()) return;
+
+				std::erase(objIt->second, cellIdx);
+
+				if (objIt->second.empty()) objCells.erase(objIt);
+			}
+
+			void Free(OBJHANDLE hObj)
+			{
+				auto objIt = objCells.find(hObj);
+
+				if (objIt == objCells.end()) return;
+
+				for (size_t cellIdx : objIt->second) cells[cellIdx] = nullptr;
+
+				objCells.erase(objIt);
+			}
+
+		private:
+			std::vector<OBJHANDLE> cells;
+			std::unordered_map<OBJHANDLE, std::vector<size_t>> objCells;
+		};
+
+		// Called when an object is grappled or deleted, as it no longer takes its ground cells
+		inline void FreeGroundCells(OBJHANDLE hObj) { for (GroundTable* pTable : groundTables) pTable->Free(hObj); }
+	}
+}
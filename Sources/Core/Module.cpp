@@ -3,6 +3,7 @@
 
 #include <filesystem>
 #include <map>
+#include <execution>
 
 DLLCLBK UACS::Core::Module* CreateModule(VESSEL* pVessel, UACS::VslAstrInfo* pVslAstrInfo, UACS::VslCargoInfo* pVslCargoInfo)
 { return new UACS::Core::Module(pVessel, pVslAstrInfo, pVslCargoInfo); }
@@ -11,6 +12,14 @@ namespace UACS
 {
 	namespace Core
 	{
+		struct Module::GroundReleases
+		{
+			std::vector<size_t> slotIdxs;
+			std::vector<UACS::Cargo*> cargoes;
+			std::vector<VESSELSTATUS2> statuses;
+			std::vector<TouchdownInfo> tdInfos;
+		};
+
 		void Module::InitAvailAstr()
 		{
 			for (const auto& entry : std::filesystem::recursive_directory_iterator(std::filesystem::current_path().string() + "/Config/Vessels/UACS/Astronauts"))
@@ -23,9 +32,48 @@ namespace UACS
 				availCargoVector.push_back(entry.path().stem().string());
 		}
 
+		void Module::PreloadAstrClass(const std::string& className)
+		{
+			if (!preloadedAstrClasses.insert(className).second) return;
+
+			FILEHANDLE hConfig = oapiOpenFile(std::format("Vessels/{}.cfg", className).c_str(), FILE_IN_ZEROONFAIL, CONFIG);
+
+			if (!hConfig) return;
+
+			// Meshes loaded globally are kept by Orbiter, so creating the astronaut later doesn't load them from disk
+			char buffer[256];
+
+			if (oapiReadItem_string(hConfig, "SuitMesh", buffer)) oapiLoadMeshGlobal(buffer);
+
+			if (oapiReadItem_string(hConfig, "BodyMesh", buffer)) oapiLoadMeshGlobal(buffer);
+
+			oapiCloseFile(hConfig, FILE_IN_ZEROONFAIL);
+
+			oapiLoadMeshGlobal("UACS/AstronautCockpit");
+		}
+
+		void Module::LoadConfig()
+		{
+			configLoaded = true;
+
+			FILEHANDLE hConfig = oapiOpenFile("UACS.cfg", FILE_IN_ZEROONFAIL, CONFIG);
+
+			if (hConfig)
+			{
+				if (!oapiReadItem_bool(hConfig, "CompactCrewRecords", compactCrewRecords))
+					oapiWriteLog("UACS warning: Couldn't read CompactCrewRecords option from config file, will use default value (FALSE)");
+
+				oapiCloseFile(hConfig, FILE_IN_ZEROONFAIL);
+			}
+
+			else oapiWriteLog("UACS warning: Couldn't load config file, will use default config");
+		}
+
 		Module::Module(VESSEL* pVessel, UACS::VslAstrInfo* pVslAstrInfo, UACS::VslCargoInfo* pVslCargoInfo) :
 			pVessel(pVessel), pVslAstrInfo(pVslAstrInfo), pVslCargoInfo(pVslCargoInfo)
 		{
+			if (!configLoaded) LoadConfig();
+
 			if (availAstrVector.empty()) InitAvailAstr();
 
 			if (pVslAstrInfo) vslAstrMap.insert({ pVessel->GetHandle(), pVslAstrInfo });
@@ -41,41 +89,67 @@ namespace UACS
 		{
 			if (!pVslAstrInfo) return false;
 
-			std::istringstream ss(line);
-			std::string data;
+			UACS::ScenarioLine scnLine(line);
+			const std::string_view key = scnLine.Next();
+
+			if (!key.starts_with("ASTR")) return false;
+
+			if (key == "ASTR_STATION")
+			{
+				size_t stationIdx;
+				if (!scnLine.Read(stationIdx)) return false;
+
+				pLoadAstrInfo = &(pVslAstrInfo->stations.at(stationIdx).astrInfo = UACS::AstrInfo()).value();
 
-			if (!(ss >> data >> std::ws) || !data._Starts_with("ASTR")) return false;
+				return true;
+			}
 
-			if (data == "ASTR_STATION")
+			// Compact record: station, alive, mass, oxygen, fuel, then the quoted class name, role, name, and custom data
+			if (key == "ASTR")
 			{
-				ss >> data;
+				size_t stationIdx;
+				if (!scnLine.Read(stationIdx)) return false;
 
-				pLoadAstrInfo = &(pVslAstrInfo->stations.at(std::stoi(data)).astrInfo = UACS::AstrInfo()).value();
+				UACS::AstrInfo& astrInfo = (pVslAstrInfo->stations.at(stationIdx).astrInfo = UACS::AstrInfo()).value();
+				pLoadAstrInfo = &astrInfo;
+
+				scnLine.Read(astrInfo.alive) && scnLine.Read(astrInfo.mass) && scnLine.Read(astrInfo.oxyLvl) && scnLine.Read(astrInfo.fuelLvl) &&
+					scnLine.ReadQuoted(astrInfo.className) && scnLine.ReadQuoted(astrInfo.role) && scnLine.ReadQuoted(astrInfo.name) && scnLine.ReadQuoted(astrInfo.customData);
 
 				return true;
 			}
 
-			if (data == "ASTR_NAME") { std::getline(ss, data); pLoadAstrInfo->name = data; return true; }
+			if (!pLoadAstrInfo) return false;
 
-			if (data == "ASTR_ROLE") { ss >> data; pLoadAstrInfo->role = data; return true; }
+			switch (UACS::HashKey(key))
+			{
+			case UACS::HashKey("ASTR_NAME"): pLoadAstrInfo->name = scnLine.Rest(); return true;
 
-			if (data == "ASTR_MASS") { ss >> data; pLoadAstrInfo->mass = std::stod(data); return true; }
+			case UACS::HashKey("ASTR_ROLE"): scnLine.Read(pLoadAstrInfo->role); return true;
 
-			if (data == "ASTR_OXYGEN") { ss >> data; pLoadAstrInfo->oxyLvl = std::stod(data); return true; }
+			case UACS::HashKey("ASTR_MASS"): scnLine.Read(pLoadAstrInfo->mass); return true;
 
-			if (data == "ASTR_FUEL") { ss >> data; pLoadAstrInfo->fuelLvl = std::stod(data); return true; }
+			case UACS::HashKey("ASTR_OXYGEN"): scnLine.Read(pLoadAstrInfo->oxyLvl); return true;
 
-			if (data == "ASTR_ALIVE") { ss >> data; pLoadAstrInfo->alive = std::stod(data); return true; }
+			case UACS::HashKey("ASTR_FUEL"): scnLine.Read(pLoadAstrInfo->fuelLvl); return true;
 
-			if (data == "ASTR_CLASSNAME") { ss >> data; pLoadAstrInfo->className = data; return true; }
+			case UACS::HashKey("ASTR_ALIVE"): scnLine.Read(pLoadAstrInfo->alive); return true;
 
-			if (data == "ASTR_CUSTOMDATA") { ss >> data; pLoadAstrInfo->customData = data; return true; }
+			case UACS::HashKey("ASTR_CLASSNAME"): scnLine.Read(pLoadAstrInfo->className); return true;
 
-			return false;
+			case UACS::HashKey("ASTR_CUSTOMDATA"): scnLine.Read(pLoadAstrInfo->customData); return true;
+
+			default: return false;
+			}
 		}
 
 		void Module::clbkPostCreation()
 		{
+			// Preloads the classes of the astronauts that can egress, so the first egress doesn't stutter
+			if (pVslAstrInfo)
+				for (const auto& stationInfo : pVslAstrInfo->stations)
+					if (stationInfo.astrInfo) PreloadAstrClass(stationInfo.astrInfo->className);
+
 			if (!pVslCargoInfo) return;
 
 			for (auto& slotInfo : pVslCargoInfo->slots) 
@@ -92,11 +166,26 @@ namespace UACS
 		{
 			if (!pVslAstrInfo) return;
 
+			std::string record;
+
 			for (size_t idx{}; idx < pVslAstrInfo->stations.size(); ++idx)
 			{
 				auto& astrInfo = pVslAstrInfo->stations.at(idx).astrInfo;
 				if (!astrInfo) continue;
 
+				if (compactCrewRecords)
+				{
+					record = std::format("{} {:d} {} {} {}", idx, astrInfo->alive, astrInfo->mass, astrInfo->oxyLvl, astrInfo->fuelLvl);
+
+					UACS::AppendQuoted(record, astrInfo->className);
+					UACS::AppendQuoted(record, astrInfo->role);
+					UACS::AppendQuoted(record, astrInfo->name);
+					UACS::AppendQuoted(record, astrInfo->customData);
+
+					oapiWriteScenario_string(scn, "ASTR", record.data());
+					continue;
+				}
+
 				oapiWriteScenario_int(scn, "ASTR_STATION", idx);
 
 				oapiWriteScenario_string(scn, "ASTR_NAME", astrInfo->name.data());
@@ -119,6 +208,8 @@ namespace UACS
 
 		size_t Module::GetScnAstrCount() { return astrVector.size(); }
 
+		size_t Module::GetScnAstrGen() { return astrGen; }
+
 		std::pair<OBJHANDLE, const UACS::AstrInfo*> Module::GetAstrInfoByIndex(size_t astrIdx) { return Core::GetAstrInfoByIndex(astrIdx); }
 
 		const UACS::AstrInfo* Module::GetAstrInfoByHandle(OBJHANDLE hAstr) { return Core::GetAstrInfoByHandle(hAstr); }
@@ -137,36 +228,30 @@ namespace UACS
 
 		void Module::DrawAstrInfo(const AstrInfo& astrInfo, oapi::Sketchpad* skp, int x, int& y, int lineSpacing)
 		{
-			std::string buffer = std::format("Name: {}", astrInfo.name);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			astrHudCache.Begin();
 
-			y += lineSpacing;
+			astrHudCache.Text(skp, x, y, "Name: {}", astrInfo.name);
 
-			buffer = astrInfo.role;
-			buffer[0] = std::toupper(buffer[0]);
+			y += lineSpacing;
 
-			buffer = std::format("Role: {}", buffer);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			astrHudCache.Text(skp, x, y, "Role: {}", UACS::Capitalized{ astrInfo.role });
 
 			y += lineSpacing;
 
-			buffer = std::format("Mass: {:g}kg", astrInfo.mass);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			astrHudCache.Text(skp, x, y, "Mass: {:g}kg", astrInfo.mass);
 
 			y += lineSpacing;
 
-			buffer = std::format("Fuel: {:g}%", astrInfo.fuelLvl * 100);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			astrHudCache.Text(skp, x, y, "Fuel: {:g}%", astrInfo.fuelLvl * 100);
 
 			y += lineSpacing;
 
-			buffer = std::format("Oxygen: {:g}%", astrInfo.oxyLvl * 100);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			astrHudCache.Text(skp, x, y, "Oxygen: {:g}%", astrInfo.oxyLvl * 100);
 
 			y += lineSpacing;
 
-			buffer = std::format("Alive: {}", astrInfo.alive ? "Yes" : "No");
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			if (astrInfo.alive) skp->Text(x, y, "Alive: Yes", 10);
+			else skp->Text(x, y, "Alive: No", 9);
 		}
 
 		size_t Module::GetAvailAstrCount() { return availAstrVector.size(); }
@@ -315,7 +400,10 @@ namespace UACS
 			{
 				VECTOR3 egressPos = airlockInfo.gndInfo.pos ? *airlockInfo.gndInfo.pos : airlockInfo.pos;
 				egressPos.y = 0;
-				if (!SetGroundPos<UACS::Astronaut>(status, egressPos, airlockInfo.gndInfo, astrVector)) return UACS::EGRS_NO_EMPTY_POS;
+				auto gndObjects = GetGroundObjects(status);
+
+				// The astronaut isn't created yet, so its cell is reserved by the next search, which finds it on the ground
+				if (!SetGroundPos(status, egressPos, airlockInfo.gndInfo, gndObjects, nullptr)) return UACS::EGRS_NO_EMPTY_POS;
 
 				SetGroundRotation(status, astrInfo->height, egressPos.x, egressPos.z);
 			}
@@ -367,6 +455,8 @@ namespace UACS
 
 		size_t Module::GetScnCargoCount() { return cargoVector.size(); }
 
+		size_t Module::GetScnCargoGen() { return cargoGen; }
+
 		UACS::CargoInfo Module::GetCargoInfoByIndex(size_t cargoIdx) { return SetCargoInfo(cargoVector.at(cargoIdx)); }
 
 		std::optional<UACS::CargoInfo> Module::GetCargoInfoByHandle(OBJHANDLE hCargo)
@@ -419,13 +509,12 @@ namespace UACS
 
 		void Module::DrawCargoInfo(UACS::CargoInfo cargoInfo, oapi::Sketchpad* skp, int x, int& y, int lineSpacing)
 		{
-			std::string buffer = std::format("Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
+			cargoHudCache.Begin();
 
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			cargoHudCache.Text(skp, x, y, "Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
 			y += lineSpacing;
 
-			buffer = std::format("Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
-			skp->Text(x, y, buffer.c_str(), buffer.size());
+			cargoHudCache.Text(skp, x, y, "Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
 
 			y += lineSpacing;
 
@@ -440,8 +529,9 @@ namespace UACS
 				else skp->Text(x, y, "Type: Unpackable", 16);
 
 				y += lineSpacing;
-				buffer = std::format("Breathable: {}", cargoInfo.breathable ? "Yes" : "No");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+
+				if (cargoInfo.breathable) skp->Text(x, y, "Breathable: Yes", 15);
+				else skp->Text(x, y, "Breathable: No", 14);
 
 				break;
 			}
@@ -450,8 +540,7 @@ namespace UACS
 			{
 				y += lineSpacing;
 
-				buffer = std::format("Resource: {}", *cargoInfo.resource);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				cargoHudCache.Text(skp, x, y, "Resource: {}", *cargoInfo.resource);
 			}
 		}
 
@@ -587,6 +676,8 @@ namespace UACS
 					return UACS::GRPL_FAIL;
 				}
 
+				InvalidateStatus(hCargo);
+				FreeGroundCells(hCargo);
 				pCargo->clbkCargoGrappled();
 				slotInfo.cargoInfo = SetCargoInfo(pCargo);
 
@@ -631,6 +722,8 @@ namespace UACS
 
 				if (pVessel->AttachChild(pCargo->GetHandle(), slotInfo.hAttach, cargoInfo->hAttach))
 				{
+					InvalidateStatus(pCargo->GetHandle());
+					FreeGroundCells(pCargo->GetHandle());
 					pCargo->clbkCargoGrappled();
 					slotInfo.cargoInfo = SetCargoInfo(pCargo);
 
@@ -647,7 +740,61 @@ namespace UACS
 		{
 			if (!slotIdx) slotIdx = GetOccupiedSlot(true);
 
-			UACS::SlotInfo& slotInfo = pVslCargoInfo->slots.at(*slotIdx);
+			std::optional<std::vector<GroundObject>> gndObjects;
+
+			return ReleaseSlot(*slotIdx, gndObjects);
+		}
+
+		std::vector<UACS::ReleaseResult> Module::ReleaseCargoBatch(std::span<const size_t> slotIdxs)
+		{
+			std::vector<UACS::ReleaseResult> results;
+			results.reserve(slotIdxs.size());
+
+			// Shared between all releases, so the scenario is scanned once. The cargoes are only moved to the ground below,
+			// so each placement reserves its cell and adds its cargo here, and the later placements avoid it
+			std::optional<std::vector<GroundObject>> gndObjects;
+
+			// Ground orientations are computed together once all cargoes are placed
+			GroundReleases gndReleases;
+
+			for (size_t slotIdx : slotIdxs) results.push_back(ReleaseSlot(slotIdx, gndObjects, &gndReleases));
+
+			SetGroundRotation(gndReleases.statuses, gndReleases.tdInfos);
+
+			for (size_t idx{}; idx < gndReleases.cargoes.size(); ++idx)
+			{
+				UACS::Cargo* pCargo = gndReleases.cargoes[idx];
+
+				pCargo->VESSEL4::DefSetStateEx(&gndReleases.statuses[idx]);
+				InvalidateStatus(pCargo->GetHandle());
+
+				// Done once the cargo is on the ground, as in the single release
+				FinishRelease(pVslCargoInfo->slots.at(gndReleases.slotIdxs[idx]), pCargo);
+			}
+
+			return results;
+		}
+
+		std::vector<std::pair<size_t, UACS::ReleaseResult>> Module::ReleaseAllCargo()
+		{
+			std::vector<size_t> slotIdxs;
+
+			for (size_t idx{}; idx < pVslCargoInfo->slots.size(); ++idx)
+				if (pVslCargoInfo->slots.at(idx).cargoInfo) slotIdxs.push_back(idx);
+
+			auto results = ReleaseCargoBatch(slotIdxs);
+
+			std::vector<std::pair<size_t, UACS::ReleaseResult>> slotResults;
+			slotResults.reserve(slotIdxs.size());
+
+			for (size_t idx{}; idx < slotIdxs.size(); ++idx) slotResults.emplace_back(slotIdxs[idx], results[idx]);
+
+			return slotResults;
+		}
+
+		UACS::ReleaseResult Module::ReleaseSlot(size_t slotIdx, std::optional<std::vector<GroundObject>>& gndObjects, GroundReleases* pGndReleases)
+		{
+			UACS::SlotInfo& slotInfo = pVslCargoInfo->slots.at(slotIdx);
 
 			if (!slotInfo.open) return UACS::RLES_SLT_CLSD;
 
@@ -668,26 +815,60 @@ namespace UACS
 				}
 				relPos.y = 0;
 
-				if (!SetGroundPos<UACS::Cargo>(status, relPos, slotInfo.gndInfo, cargoVector, pCargo)) return UACS::RLES_NO_EMPTY_POS;
+				if (!gndObjects) gndObjects = GetGroundObjects(status, pCargo);
+
+				const OBJHANDLE hCargo = pCargo->GetHandle();
+
+				if (!SetGroundPos(status, relPos, slotInfo.gndInfo, *gndObjects, hCargo)) return UACS::RLES_NO_EMPTY_POS;
+
+				if (!pVessel->DetachChild(slotInfo.hAttach))
+				{
+					// The cargo is still attached, so its reservation is dropped
+					FreeGroundCells(hCargo);
+					std::erase_if(*gndObjects, [hCargo](const GroundObject& gndObject) { return gndObject.hObj == hCargo; });
+
+					return UACS::RLES_FAIL;
+				}
 
-				if (!pVessel->DetachChild(slotInfo.hAttach)) return UACS::RLES_FAIL;
+				InvalidateStatus(pCargo->GetHandle());
 
-				if (pVslCargoInfo->astrMode) status.surf_hdg = fmod(GetVesselStatus(pCargo).surf_hdg + PI, PI2);
+				if (pVslCargoInfo->astrMode) status.surf_hdg = fmod(GetCachedStatus(pCargo).surf_hdg + PI, PI2);
 				
 				auto cargoInfo = pCargo->clbkGetCargoInfo();
 
-				SetGroundRotation(status, cargoInfo->frontPos, cargoInfo->rightPos, cargoInfo->leftPos, relPos.x, relPos.z);
+				if (pGndReleases)
+				{
+					status.surf_lng += relPos.x;
+					status.surf_lat += relPos.z;
 
-				pCargo->DefSetStateEx(&status);
+					pGndReleases->slotIdxs.push_back(slotIdx);
+					pGndReleases->cargoes.push_back(pCargo);
+					pGndReleases->statuses.push_back(status);
+					pGndReleases->tdInfos.push_back({ cargoInfo->frontPos, cargoInfo->rightPos, cargoInfo->leftPos });
+				}
+				else
+				{
+					SetGroundRotation(status, cargoInfo->frontPos, cargoInfo->rightPos, cargoInfo->leftPos, relPos.x, relPos.z);
+
+					// The API version isn't linked to the core, so the status is invalidated here
+					pCargo->VESSEL4::DefSetStateEx(&status);
+					InvalidateStatus(pCargo->GetHandle());
+				}
 			}
 			else if (!pVessel->DetachChild(slotInfo.hAttach, slotInfo.relVel)) return UACS::RLES_FAIL;
 
+			// Batched ground releases are finished by ReleaseCargoBatch once their states are set
+			if (!pVessel->GetFlightStatus() || !pGndReleases) FinishRelease(slotInfo, pCargo);
+
+			return UACS::RLES_SUCCED;
+		}
+
+		void Module::FinishRelease(UACS::SlotInfo& slotInfo, UACS::Cargo* pCargo)
+		{
 			SetAttachPos(false, slotInfo.cargoInfo->unpacked, slotInfo);
 
 			pCargo->clbkCargoReleased();
 			slotInfo.cargoInfo = {};
-
-			return UACS::RLES_SUCCED;
 		}
 
 		UACS::PackResult Module::PackCargo(OBJHANDLE hCargo)
@@ -922,92 +1103,206 @@ namespace UACS
 			pVessel->SetAttachmentParams(slotInfo.hAttach, slotPos, slotDir, slotRot);
 		}
 
-		template<typename T>
-		bool Module::SetGroundPos(const VESSELSTATUS2& vslStatus, VECTOR3& initPos, UACS::GroundInfo gndInfo, std::span<T*> objSpan, const T* pOrgObj)
+		std::vector<Module::GroundObject> Module::GetGroundObjects(const VESSELSTATUS2& vslStatus, const VESSEL* pOrgObj)
+		{
+			const double bodySize = oapiGetSize(vslStatus.rbody);
+
+			std::vector<GroundObject> gndObjects;
+			gndObjects.reserve(astrVector.size() + cargoVector.size());
+
+			auto addObject = [&](const VESSEL* pObject)
+			{
+				if (pObject == pOrgObj) return;
+
+				const VESSELSTATUS2& objStatus = GetCachedStatus(pObject);
+
+				if (!objStatus.status || objStatus.rbody != vslStatus.rbody) return;
+
+				gndObjects.push_back({ pObject->GetHandle(), {}, objStatus.surf_lng, objStatus.surf_lat });
+			};
+
+			// Both astronauts and cargoes are included, so egress and release don't place objects over each other
+			for (const UACS::Astronaut* pAstr : astrVector) addObject(pAstr);
+			for (const UACS::Cargo* pCargo : cargoVector) addObject(pCargo);
+
+			// The statuses are snapshotted above, as Orbiter can only be called from the main thread
+			auto setPos = [&](GroundObject& gndObject)
+			{ gndObject.pos = LngLat2Local(bodySize, vslStatus.surf_lng, vslStatus.surf_lat, vslStatus.surf_hdg, gndObject.lng, gndObject.lat); };
+
+			if (gndObjects.size() >= parGeodesyMinCount) std::for_each(std::execution::par, gndObjects.begin(), gndObjects.end(), setPos);
+			else std::ranges::for_each(gndObjects, setPos);
+
+			return gndObjects;
+		}
+
+		GroundTable& Module::GetGroundTable(const VESSELSTATUS2& vslStatus, const VECTOR3& initPos, const UACS::GroundInfo& gndInfo,
+			const VECTOR3& rowStep, const VECTOR3& colStep, std::span<const GroundObject> gndObjects)
 		{
-			if (!pVslCargoInfo->astrMode)
+			GroundTable& table = gndTables[&gndInfo];
+
+			const double bodySize = oapiGetSize(vslStatus.rbody);
+			const size_t cellCount = gndInfo.rowCount * gndInfo.colCount;
+
+			auto samePos = [](const VECTOR3& pos1, const VECTOR3& pos2) { return length(pos1 - pos2) < 1e-3; };
+
+			// The table is kept as long as the vessel hasn't moved and the grid is unchanged
+			if (table.hBody == vslStatus.rbody && table.Size() == cellCount && table.colCount == gndInfo.colCount &&
+				samePos(table.initPos, initPos) && samePos(table.rowStep, rowStep) && samePos(table.colStep, colStep) &&
+				abs(table.hdg - vslStatus.surf_hdg) < 1e-4 && DistLngLat(bodySize, table.lng, table.lat, vslStatus.surf_lng, vslStatus.surf_lat) < 0.01)
+				return table;
+
+			table.hBody = vslStatus.rbody;
+			table.lng = vslStatus.surf_lng;
+			table.lat = vslStatus.surf_lat;
+			table.hdg = vslStatus.surf_hdg;
+			table.initPos = initPos;
+			table.rowStep = rowStep;
+			table.colStep = colStep;
+			table.colCount = gndInfo.colCount;
+			table.Reset(cellCount);
+
+			// Cell (row, col) is centered at initPos + row * rowStep + col * colStep
+			const double det = rowStep.x * colStep.z - rowStep.z * colStep.x;
+			const bool degenerate = abs(det) < 1e-9;
+			const double spaceMargin = 0.5 * gndInfo.colSpace;
+
+			// How many cells away from an object its margin can reach along each axis
+			const double rowReach = degenerate ? double(gndInfo.rowCount) : spaceMargin * length(colStep) / abs(det);
+			const double colReach = degenerate ? double(gndInfo.colCount) : spaceMargin * length(rowStep) / abs(det);
+
+			for (const GroundObject& gndObject : gndObjects)
 			{
-				if (!gndInfo.colDir || !gndInfo.rowDir)
+				if (!gndObject.hObj) continue;
+
+				const VECTOR3 objPos = { gndObject.pos.x - initPos.x, 0, gndObject.pos.z - initPos.z };
+
+				// Object position in grid units
+				const double rowCoord = degenerate ? 0 : (objPos.x * colStep.z - objPos.z * colStep.x) / det;
+				const double colCoord = degenerate ? 0 : (rowStep.x * objPos.z - rowStep.z * objPos.x) / det;
+
+				if (rowCoord + rowReach < 0 || rowCoord - rowReach > double(gndInfo.rowCount - 1)) continue;
+				if (colCoord + colReach < 0 || colCoord - colReach > double(gndInfo.colCount - 1)) continue;
+
+				const int rowEnd = min(int(floor(rowCoord + rowReach)), int(gndInfo.rowCount) - 1);
+				const int colEnd = min(int(floor(colCoord + colReach)), int(gndInfo.colCount) - 1);
+
+				for (int row = max(int(ceil(rowCoord - rowReach)), 0); row <= rowEnd; ++row)
 				{
-					if (abs(initPos.z) > abs(initPos.x))
-					{
-						gndInfo.colDir = _V((initPos.x < 0 ? -1 : 1), 0, 0);
-						gndInfo.rowDir = _V(0, 0, (initPos.z < 0 ? -1 : 1));
-					}
-					else
+					for (int col = max(int(ceil(colCoord - colReach)), 0); col <= colEnd; ++col)
 					{
-						gndInfo.colDir = _V(0, 0, (initPos.z < 0 ? -1 : 1));
-						gndInfo.rowDir = _V((initPos.x < 0 ? -1 : 1), 0, 0);
+						const double dx = objPos.x - row * rowStep.x - col * colStep.x;
+						const double dz = objPos.z - row * rowStep.z - col * colStep.z;
+
+						if (dx * dx + dz * dz <= spaceMargin * spaceMargin) table.Reserve(row * gndInfo.colCount + col, gndObject.hObj);
 					}
 				}
 			}
 
+			return table;
+		}
+
+		bool Module::SetGroundPos(const VESSELSTATUS2& vslStatus, VECTOR3& initPos, const UACS::GroundInfo& gndInfo, std::vector<GroundObject>& gndObjects, OBJHANDLE hObj)
+		{
+			const bool astrMode = pVslCargoInfo && pVslCargoInfo->astrMode;
 			const double bodySize = oapiGetSize(vslStatus.rbody);
 			VECTOR3 finalPos = initPos;
+			bool reserved{};
 
-			if (!pVslCargoInfo->astrMode)
+			if (!astrMode)
 			{
-				size_t colCount{}, rowCount{};
-				double spaceMargin = 0.5 * gndInfo.colSpace;
+				if (!gndInfo.colCount || !gndInfo.rowCount) return false;
 
-			groundPosLoop:
-				for (const T* pObject : objSpan)
+				VECTOR3 colDir, rowDir;
+
+				if (gndInfo.colDir && gndInfo.rowDir)
+				{
+					colDir = *gndInfo.colDir;
+					rowDir = *gndInfo.rowDir;
+				}
+				else if (abs(initPos.z) > abs(initPos.x))
 				{
-					if (pObject == pOrgObj) continue;
+					colDir = _V((initPos.x < 0 ? -1 : 1), 0, 0);
+					rowDir = _V(0, 0, (initPos.z < 0 ? -1 : 1));
+				}
+				else
+				{
+					colDir = _V(0, 0, (initPos.z < 0 ? -1 : 1));
+					rowDir = _V((initPos.x < 0 ? -1 : 1), 0, 0);
+				}
 
-					auto objStatus = GetVesselStatus(pObject);
+				GroundTable& table = GetGroundTable(vslStatus, initPos, gndInfo, colDir * gndInfo.rowSpace, rowDir * gndInfo.colSpace, gndObjects);
 
-					if (!objStatus.status || objStatus.rbody != vslStatus.rbody) continue;
+				const double spaceMargin = 0.5 * gndInfo.colSpace;
 
-					auto posCoords = Local2LngLat(bodySize, vslStatus.surf_lng, vslStatus.surf_lat, vslStatus.surf_hdg, finalPos);
+				auto getCellPos = [&](size_t cellIdx)
+				{ return initPos + table.rowStep * double(cellIdx / gndInfo.colCount) + table.colStep * double(cellIdx % gndInfo.colCount); };
 
-					if (DistLngLat(bodySize, objStatus.surf_lng, objStatus.surf_lat, posCoords.first, posCoords.second) > spaceMargin) continue;
+				auto isOnCell = [&](const GroundObject& gndObject, const VECTOR3& cellPos)
+				{
+					const double dx = gndObject.pos.x - cellPos.x;
+					const double dz = gndObject.pos.z - cellPos.z;
 
-					++colCount;
+					return dx * dx + dz * dz <= spaceMargin * spaceMargin;
+				};
 
-					if (colCount >= gndInfo.rowCount)
-					{
-						++rowCount;
+				// Objects unknown to the table, such as ones released by other grids, can still be on a free cell
+				auto findBlocker = [&](size_t cellIdx)
+				{
+					const VECTOR3 cellPos = getCellPos(cellIdx);
 
-						if (rowCount >= gndInfo.rowCount) return false;
+					return size_t(std::ranges::find_if(gndObjects, [&](const GroundObject& gndObject) { return isOnCell(gndObject, cellPos); }) - gndObjects.begin());
+				};
 
-						colCount = 0;
+				std::unordered_map<OBJHANDLE, size_t> objIdxs;
+				objIdxs.reserve(gndObjects.size());
 
-						finalPos = initPos;
+				for (size_t objIdx{}; objIdx < gndObjects.size(); ++objIdx) if (gndObjects[objIdx].hObj) objIdxs.emplace(gndObjects[objIdx].hObj, objIdx);
 
-						finalPos.x += gndInfo.rowSpace * rowCount * gndInfo.colDir->x;
-						finalPos.z += gndInfo.rowSpace * rowCount * gndInfo.colDir->z;
-					}
+				// A reserved cell is kept while its object is still landed on it. Otherwise, such as when an astronaut walked away, it's freed and used again
+				auto isHeld = [&](size_t cellIdx)
+				{
+					auto objIt = objIdxs.find(table.Holder(cellIdx));
+
+					return objIt != objIdxs.end() && isOnCell(gndObjects[objIt->second], getCellPos(cellIdx));
+				};
+
+				// The search stops at the first unblocked cell. Blocked cells are reserved for their objects
+				size_t cellIdx{};
 
-					else
+				for (; cellIdx < table.Size(); ++cellIdx)
+				{
+					if (!table.IsFree(cellIdx))
 					{
-						finalPos.x += gndInfo.colSpace * gndInfo.rowDir->x;
-						finalPos.z += gndInfo.colSpace * gndInfo.rowDir->z;
+						if (isHeld(cellIdx)) continue;
+
+						table.FreeCell(cellIdx);
 					}
 
-					goto groundPosLoop;
+					const size_t objIdx = findBlocker(cellIdx);
+
+					if (objIdx == gndObjects.size()) break;
+
+					table.Reserve(cellIdx, gndObjects[objIdx].hObj);
 				}
+
+				if (cellIdx == table.Size()) return false;
+
+				finalPos = getCellPos(cellIdx);
+
+				if (hObj) { table.Reserve(cellIdx, hObj); reserved = true; }
 			}
 
 			auto posCoords = Local2LngLat(bodySize, vslStatus.surf_lng, vslStatus.surf_lat, vslStatus.surf_hdg, finalPos);
 
+			// Later placements against the same objects must see this one, including ones on other grids
+			if (reserved) gndObjects.push_back({ hObj, finalPos, posCoords.first, posCoords.second });
+
 			initPos.x = posCoords.first - vslStatus.surf_lng;
 			initPos.z = posCoords.second - vslStatus.surf_lat;
 
 			return true;
 		}
 
-		std::pair<double, double> Module::Local2LngLat(double bodySize, double lng, double lat, double hdg, VECTOR3 pos)
-		{
-			double dist = length(pos) / bodySize;
-			double finalHdg = fmod(atan2(pos.x, pos.z) + PI2 + hdg, PI2);
-
-			double finalLat = asin(sin(lat) * cos(dist) + cos(lat) * sin(dist) * cos(finalHdg));
-			double finalLng = atan2(sin(finalHdg) * sin(dist) * cos(lat), cos(dist) - sin(lat) * sin(finalLat)) + lng;
-
-			return { finalLng, finalLat };
-		}
-
 		size_t Module::GetOccupiedStation()
 		{
 			for (size_t idx{}; idx < pVslAstrInfo->stations.size(); ++idx)			
@@ -1,8 +1,11 @@
 #pragma once
 #include "..\API\Module.h"
 #include "..\API\Cargo.h"
+#include "..\HudCommon.h"
+#include "GroundTable.h"
 
 #include <span>
+#include <unordered_map>
 
 namespace UACS
 {
@@ -82,24 +85,56 @@ namespace UACS
 
 			virtual std::pair<UACS::DrainResult, double> DrainStationResource(std::string_view, double, OBJHANDLE);
 
+			virtual std::vector<UACS::ReleaseResult> ReleaseCargoBatch(std::span<const size_t>);
+
+			virtual std::vector<std::pair<size_t, UACS::ReleaseResult>> ReleaseAllCargo();
+
+			virtual size_t GetScnAstrGen();
+
+			virtual size_t GetScnCargoGen();
+
 		private:
+			inline static bool configLoaded{};
+			inline static bool compactCrewRecords{};
+			static void LoadConfig();
+
 			inline static std::vector<std::string> availCargoVector, availAstrVector;
 			static void InitAvailCargo();
 			static void InitAvailAstr();
+			static void PreloadAstrClass(const std::string& className);
 
 			VESSEL* pVessel;
 			UACS::VslAstrInfo* pVslAstrInfo;
 			UACS::VslCargoInfo* pVslCargoInfo;
 
+			UACS::HudCache<5> astrHudCache;
+			UACS::HudCache<3> cargoHudCache;
+
 			UACS::AstrInfo* pLoadAstrInfo{};
 			bool passCheck{};
 
 			double GetTgtVslDist(VESSEL* pTgtVsl) const;
 			void SetAttachPos(bool attach, bool unpacked, const UACS::SlotInfo& slotInfo);			
 
-			template<typename T>
-			bool SetGroundPos(const VESSELSTATUS2& vslStatus, VECTOR3& initPos, UACS::GroundInfo gndInfo, std::span<T*> objSpan, const T* pOrgObj = nullptr);
-			std::pair<double, double> Local2LngLat(double bodySize, double lng, double lat, double hdg, VECTOR3 pos);
+			struct GroundObject
+			{
+				OBJHANDLE hObj;
+				VECTOR3 pos;
+				double lng, lat;
+			};
+
+			// Keyed by the airlock or slot ground info, so egress and release grids are kept separately
+			std::unordered_map<const UACS::GroundInfo*, GroundTable> gndTables;
+
+			std::vector<GroundObject> GetGroundObjects(const VESSELSTATUS2& vslStatus, const VESSEL* pOrgObj = nullptr);
+			GroundTable& GetGroundTable(const VESSELSTATUS2& vslStatus, const VECTOR3& initPos, const UACS::GroundInfo& gndInfo, const VECTOR3& rowStep, const VECTOR3& colStep,
+				std::span<const GroundObject> gndObjects);
+			bool SetGroundPos(const VESSELSTATUS2& vslStatus, VECTOR3& initPos, const UACS::GroundInfo& gndInfo, std::vector<GroundObject>& gndObjects, OBJHANDLE hObj);
+
+			struct GroundReleases;
+
+			UACS::ReleaseResult ReleaseSlot(size_t slotIdx, std::optional<std::vector<GroundObject>>& gndObjects, GroundReleases* pGndReleases = nullptr);
+			void FinishRelease(UACS::SlotInfo& slotInfo, UACS::Cargo* pCargo);
 
 			size_t GetOccupiedStation();
 			size_t GetTransferAirlock();
@@ -0,0 +1,214 @@
+#pragma once
+#include <Orbitersdk.h>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cctype>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace UACS
+{
+	// Formats a string with its first character capitalized, without copying it
+	struct Capitalized { std::string_view str; };
+
+	// HUD columns and line spacing, which are only computed again when the HUD size or font changes
+	class HudLayout
+	{
+	public:
+		int leftX{}, rightX{}, startY{};
+		int smallSpace{}, space{}, largeSpace{};
+
+		// Returns true if the layout was computed again. startRatio is the first line position as a ratio of the HUD height
+		bool Set(const HUDPAINTSPEC* hps, oapi::Sketchpad* skp, double startRatio)
+		{
+			const DWORD newCharSize = skp->GetCharSize();
+
+			if (newCharSize == charSize && hps->W == width && hps->H == height) return false;
+
+			charSize = newCharSize;
+			width = hps->W;
+			height = hps->H;
+
+			leftX = HIWORD(charSize);
+			rightX = width - leftX;
+			startY = int(startRatio * height);
+
+			space = LOWORD(charSize);
+			smallSpace = int(0.5 * space);
+			largeSpace = int(1.5 * space);
+
+			return true;
+		}
+
+	private:
+		DWORD charSize{};
+		int width{}, height{};
+	};
+
+	// A HUD line formatted into a fixed buffer. It's only formatted again if the format string or the values change
+	class HudLine
+	{
+	public:
+		template<typename... Args>
+		std::string_view Format(std::format_string<Args...> fmt, Args&&... args)
+		{
+			// The format string and values are compared by their bytes. The buffers keep their capacity, so nothing is allocated once the line is used
+			const char* fmtData = fmt.get().data();
+
+			newKey.clear();
+			AppendBytes(newKey, &fmtData, sizeof(fmtData));
+			(AppendValue(newKey, args), ...);
+
+			if (!formatted || newKey != key)
+			{
+				// Longer lines are cut, as they wouldn't fit in the HUD anyway
+				const auto result = std::format_to_n(text.data(), text.size(), fmt, std::forward<Args>(args)...);
+
+				size = min(size_t(result.size), text.size());
+				key.swap(newKey);
+				formatted = true;
+			}
+
+			return { text.data(), size };
+		}
+
+		template<typename... Args>
+		void Text(oapi::Sketchpad* skp, int x, int y, std::format_string<Args...> fmt, Args&&... args)
+		{
+			const std::string_view line = Format(fmt, std::forward<Args>(args)...);
+
+			skp->Text(x, y, line.data(), int(line.size()));
+		}
+
+	private:
+		std::array<char, 128> text;
+		size_t size{};
+		std::string key, newKey;
+		bool formatted{};
+
+		static void AppendBytes(std::string& key, const void* data, size_t size) { key.append(static_cast<const char*>(data), size); }
+
+		// Strings are copied with their size, as they may point to memory which changes or is freed after the call
+		static void AppendString(std::string& key, std::string_view str)
+		{
+			const size_t strSize = str.size();
+
+			AppendBytes(key, &strSize, sizeof(strSize));
+			key.append(str);
+		}
+
+		template<typename T>
+		static void AppendValue(std::string& key, const T& value)
+		{
+			if constexpr (std::is_same_v<T, Capitalized>) AppendString(key, value.str);
+
+			else if constexpr (std::is_convertible_v<const T&, std::string_view>) AppendString(key, value);
+
+			else
+			{
+				static_assert(std::is_scalar_v<T>, "HUD line values must be strings or scalars");
+
+				AppendBytes(key, &value, sizeof(value));
+			}
+		}
+	};
+
+	// The formatted lines of a HUD, used in drawing order. Begin should be called before each frame is drawn
+	template<size_t lineCount>
+	class HudCache
+	{
+	public:
+		void Begin() { lineIdx = 0; }
+
+		template<typename... Args>
+		void Text(oapi::Sketchpad* skp, int x, int y, std::format_string<Args...> fmt, Args&&... args)
+		{
+			// The cache should be sized to the lines drawn. Extra lines share the last line, so they're formatted every time
+			assert(lineIdx < lineCount);
+
+			HudLine& line = lines[min(lineIdx++, lineCount - 1)];
+
+			line.Text(skp, x, y, fmt, std::forward<Args>(args)...);
+		}
+
+	private:
+		std::array<HudLine, lineCount> lines;
+		size_t lineIdx{};
+	};
+
+	// A sketchpad which records the text drawn on it, so a HUD can be computed at a lower rate and drawn every frame
+	template<size_t lineCount>
+	class HudRecorder : public oapi::Sketchpad
+	{
+	public:
+		HudRecorder() : oapi::Sketchpad(nullptr) {}
+
+		void Clear() { size = 0; align = LEFT; }
+
+		void SetTextAlign(TAlign_horizontal tah = LEFT, TAlign_vertical tav = TOP) override { align = tah; }
+
+		bool Text(int x, int y, const char* str, int len) override
+		{
+			if (size == lines.size()) return false;
+
+			Line& line = lines[size++];
+
+			line.x = x;
+			line.y = y;
+			line.align = align;
+			line.len = min(len, int(line.text.size()));
+
+			std::copy_n(str, line.len, line.text.data());
+
+			return true;
+		}
+
+		void Draw(oapi::Sketchpad* skp) const
+		{
+			for (size_t idx{}; idx < size; ++idx)
+			{
+				const Line& line = lines[idx];
+
+				if (!idx || line.align != lines[idx - 1].align) skp->SetTextAlign(line.align);
+
+				skp->Text(line.x, line.y, line.text.data(), line.len);
+			}
+
+			skp->SetTextAlign(LEFT);
+		}
+
+	private:
+		struct Line
+		{
+			int x, y;
+			TAlign_horizontal align;
+			std::array<char, 128> text;
+			int len;
+		};
+
+		std::array<Line, lineCount> lines;
+		size_t size{};
+		TAlign_horizontal align{ LEFT };
+	};
+}
+
+template<>
+struct std::formatter<UACS::Capitalized>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	template<typename FormatContext>
+	auto format(const UACS::Capitalized& value, FormatContext& ctx) const
+	{
+		auto out = ctx.out();
+
+		if (value.str.empty()) return out;
+
+		*out++ = char(std::toupper(static_cast<unsigned char>(value.str.front())));
+
+		return std::ranges::copy(value.str.substr(1), out).out;
+	}
+};
@@ -0,0 +1,104 @@
+// Checks the elevation cache reads, tile level refreshes and clock eviction
+#include <cstdio>
+#include <BaseCommon.h>
+
+void oapiWriteLogV(const char*, ...) {}
+OBJHANDLE oapiGetVesselByName(char*) { return nullptr; }
+double oapiGetSysTime() { return 0; }
+double oapiGetSize(OBJHANDLE) { return 1; }
+
+namespace
+{
+	int tileLevel = 10;
+	size_t readCount{};
+
+	OBJHANDLE Body(uintptr_t id) { return reinterpret_cast<OBJHANDLE>(id); }
+
+	size_t failures{};
+
+	void Check(bool condition, const char* message)
+	{
+		if (condition) return;
+
+		printf("Failed: %s\n", message);
+		++failures;
+	}
+}
+
+double oapiSurfaceElevationEx(OBJHANDLE, double lng, double, int, std::vector<ElevationTile>*, VECTOR3*, int* lvl)
+{
+	++readCount;
+
+	if (lvl) *lvl = tileLevel;
+
+	return lng + tileLevel;
+}
+
+int main()
+{
+	const double bodySize = 1e6;
+	const OBJHANDLE hBody = Body(1), hOtherBody = Body(2);
+
+	{
+		UACS::ElevationCache cache(16);
+
+		cache.Get(hBody, bodySize, 0, 0);
+		cache.Get(hBody, bodySize, 0, 0);
+		cache.Get(hBody, bodySize, 0.01 / bodySize, 0);
+
+		Check(readCount == 1, "samples in the same cell are read once");
+
+		cache.Get(hBody, bodySize, 1 / bodySize, 0);
+
+		Check(readCount == 2, "samples in another cell are read");
+	}
+
+	{
+		UACS::ElevationCache cache(16);
+		readCount = 0;
+		tileLevel = 10;
+
+		cache.Get(hBody, bodySize, 0, 0);
+		cache.Get(hOtherBody, bodySize, 0, 0);
+
+		// A finer tile is loaded and seen by a new sample
+		tileLevel = 12;
+		cache.Get(hBody, bodySize, 1 / bodySize, 0);
+
+		Check(cache.Get(hBody, bodySize, 0, 0) == 12 && readCount == 4, "coarser samples are read again once a finer level is seen");
+
+		cache.Get(hBody, bodySize, 0, 0);
+		cache.Get(hOtherBody, bodySize, 0, 0);
+
+		Check(readCount == 4, "samples are read again only once per finer level, and only on the same body");
+	}
+
+	{
+		UACS::ElevationCache cache(4);
+		readCount = 0;
+
+		for (int idx = 0; idx < 4; ++idx) cache.Get(hBody, bodySize, idx / bodySize, 0);
+
+		// The first pass of the hand clears all the flags, then the first sample is replaced.
+		// The second sample is used again, so the hand skips it and replaces the third one.
+		cache.Get(hBody, bodySize, 4 / bodySize, 0);
+		cache.Get(hBody, bodySize, 1 / bodySize, 0);
+		cache.Get(hBody, bodySize, 5 / bodySize, 0);
+
+		Check(cache.Size() == 4, "the cache doesn't grow past its capacity");
+		Check(readCount == 6, "used samples stay in the cache");
+
+		cache.Get(hBody, bodySize, 1 / bodySize, 0);
+		cache.Get(hBody, bodySize, 3 / bodySize, 0);
+
+		Check(readCount == 6, "recently used samples are kept");
+
+		cache.Get(hBody, bodySize, 2 / bodySize, 0);
+
+		Check(readCount == 7, "replaced samples are read again");
+	}
+
+	printf("ElevationCache: %zu failures\n", failures);
+
+	return failures ? 1 : 0;
+}
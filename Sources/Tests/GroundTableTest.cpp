@@ -0,0 +1,78 @@
+// Checks the ground table reservations and the freeing of grappled, deleted or moved objects
+#include <cstdio>
+#include <Core/GroundTable.h>
+
+namespace
+{
+	size_t failures{};
+
+	void Check(bool condition, const char* message)
+	{
+		if (condition) return;
+
+		printf("Failed: %s\n", message);
+		++failures;
+	}
+
+	OBJHANDLE Object(uintptr_t id) { return reinterpret_cast<OBJHANDLE>(id); }
+}
+
+int main()
+{
+	using UACS::Core::GroundTable;
+
+	{
+		GroundTable table;
+		table.Reset(6);
+
+		Check(table.IsFree(0) && !table.Holder(0), "an empty table has no reserved cell");
+
+		table.Reserve(0, Object(1));
+		table.Reserve(1, Object(2));
+		table.Reserve(3, Object(2));
+
+		Check(table.Holder(0) == Object(1) && table.Holder(1) == Object(2) && table.Holder(3) == Object(2), "reserved cells keep their objects");
+
+		table.Reserve(4, nullptr);
+
+		Check(table.IsFree(4), "cells aren't reserved without an object");
+
+		UACS::Core::FreeGroundCells(Object(2));
+
+		Check(table.IsFree(1) && table.IsFree(3), "all the cells of a freed object are freed");
+
+		table.Reserve(1, Object(4));
+		table.Reserve(1, Object(5));
+		UACS::Core::FreeGroundCells(Object(5));
+
+		Check(table.Holder(1) == Object(4), "a reserved cell keeps its first object");
+
+		table.Reserve(3, Object(6));
+		table.Reserve(4, Object(6));
+		table.FreeCell(3);
+
+		Check(table.IsFree(3) && table.Holder(4) == Object(6), "a freed cell doesn't free the other cells of its object");
+
+		UACS::Core::FreeGroundCells(Object(6));
+
+		Check(table.IsFree(4), "an object is freed from its remaining cells");
+
+		table.Reserve(3, Object(7));
+		table.FreeCell(3);
+		UACS::Core::FreeGroundCells(Object(7));
+		table.Reserve(3, Object(8));
+		UACS::Core::FreeGroundCells(Object(7));
+
+		Check(table.Holder(3) == Object(8), "an object no longer holds a cell freed on its own");
+
+		table.Reset(4);
+
+		Check(table.Size() == 4 && table.IsFree(0) && table.IsFree(1), "a reset table is empty");
+	}
+
+	Check(UACS::Core::groundTables.empty(), "destroyed tables are unregistered");
+
+	printf("GroundTable: %zu failures\n", failures);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+// Compares the closed form SetGroundArot with the RotationMatrix product it replaced
+#include <cstdio>
+#include <random>
+#include <BaseCommon.h>
+
+void oapiWriteLogV(const char*, ...) {}
+OBJHANDLE oapiGetVesselByName(char*) { return nullptr; }
+double oapiGetSysTime() { return 0; }
+double oapiGetSize(OBJHANDLE) { return 1; }
+double oapiSurfaceElevationEx(OBJHANDLE, double, double, int, std::vector<ElevationTile>*, VECTOR3*, int*) { return 0; }
+
+namespace
+{
+	// The previous implementation of SetGroundArot
+	void SetGroundArotChain(VESSELSTATUS2& status, double tilt, double roll)
+	{
+		const MATRIX3 rot1 = UACS::RotationMatrix({ 0, PI05 - status.surf_lng, 0 });
+		const MATRIX3 rot2 = UACS::RotationMatrix({ -status.surf_lat, 0, 0 });
+		const MATRIX3 rot3 = UACS::RotationMatrix({ 0, 0, PI + status.surf_hdg });
+		const MATRIX3 rot4 = UACS::RotationMatrix({ tilt, 0, roll });
+		const MATRIX3 RotMatrix_Def = mul(rot1, mul(rot2, mul(rot3, rot4)));
+
+		status.arot.x = atan2(RotMatrix_Def.m23, RotMatrix_Def.m33);
+		status.arot.y = -asin(RotMatrix_Def.m13);
+		status.arot.z = atan2(RotMatrix_Def.m12, RotMatrix_Def.m11);
+	}
+
+	// Rebuilds the matrix the Euler angles were taken from. Comparing the matrices rather than the angles
+	// avoids false mismatches at the atan2 cut and at gimbal lock, where several angle sets give the same rotation
+	MATRIX3 ArotMatrix(const VECTOR3& arot) { return UACS::RotationMatrix({ -arot.x, -arot.y, -arot.z }); }
+
+	bool Compare(double lng, double lat, double hdg, double tilt, double roll)
+	{
+		VESSELSTATUS2 expected{}, actual{};
+
+		expected.surf_lng = actual.surf_lng = lng;
+		expected.surf_lat = actual.surf_lat = lat;
+		expected.surf_hdg = actual.surf_hdg = hdg;
+
+		SetGroundArotChain(expected, tilt, roll);
+		UACS::SetGroundArot(actual, tilt, roll);
+
+		const MATRIX3 expectedMatrix = ArotMatrix(expected.arot), actualMatrix = ArotMatrix(actual.arot);
+
+		double error{};
+
+		for (int idx = 0; idx < 9; ++idx) error = max(error, abs(expectedMatrix.data[idx] - actualMatrix.data[idx]));
+
+		if (error < 1e-9) return true;
+
+		printf("Mismatch at lng %g, lat %g, hdg %g, tilt %g, roll %g: expected (%.12f, %.12f, %.12f), got (%.12f, %.12f, %.12f)\n",
+			lng, lat, hdg, tilt, roll, expected.arot.x, expected.arot.y, expected.arot.z, actual.arot.x, actual.arot.y, actual.arot.z);
+
+		return false;
+	}
+}
+
+int main()
+{
+	size_t failures{};
+
+	// Flat ground, as used by the ground SetGroundRotation overloads
+	for (double lat = -80; lat <= 80; lat += 20)
+		for (double lng = -180; lng < 180; lng += 30)
+			for (double hdg = 0; hdg < 360; hdg += 45)
+				if (!Compare(lng * RAD, lat * RAD, hdg * RAD, PI05, 0)) ++failures;
+
+	// Sloped ground, with the pitch and roll ranges the touchdown points can produce
+	std::mt19937_64 engine(0x5EED);
+	std::uniform_real_distribution<double> lngDist(-PI, PI), latDist(-89 * RAD, 89 * RAD), hdgDist(0, PI2), slopeDist(-PI05, PI05);
+
+	for (int idx = 0; idx < 100000; ++idx)
+		if (!Compare(lngDist(engine), latDist(engine), hdgDist(engine), PI05 - slopeDist(engine), slopeDist(engine))) ++failures;
+
+	printf("SetGroundArot: %zu mismatches\n", failures);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,88 @@
+#pragma once
+// Minimal stand-in for the Orbiter SDK header, so BaseCommon.h can be tested without the SDK.
+// The standard headers are included before the min and max macros are defined, as windows.h does.
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+typedef void* OBJHANDLE;
+
+const double PI = 3.14159265358979323846;
+const double PI05 = 1.57079632679489661923;
+const double PI2 = 6.28318530717958647693;
+const double RAD = PI / 180.0;
+
+typedef union { double data[3]; struct { double x, y, z; }; } VECTOR3;
+typedef union { double data[9]; struct { double m11, m12, m13, m21, m22, m23, m31, m32, m33; }; } MATRIX3;
+
+inline VECTOR3 _V(double x, double y, double z) { VECTOR3 v; v.x = x; v.y = y; v.z = z; return v; }
+
+inline MATRIX3 _M(double m11, double m12, double m13, double m21, double m22, double m23, double m31, double m32, double m33)
+{
+	MATRIX3 m;
+	m.m11 = m11; m.m12 = m12; m.m13 = m13;
+	m.m21 = m21; m.m22 = m22; m.m23 = m23;
+	m.m31 = m31; m.m32 = m32; m.m33 = m33;
+	return m;
+}
+
+inline MATRIX3 mul(const MATRIX3& a, const MATRIX3& b)
+{
+	MATRIX3 m;
+
+	for (int row = 0; row < 3; ++row)
+		for (int col = 0; col < 3; ++col)
+			m.data[row * 3 + col] = a.data[row * 3] * b.data[col] + a.data[row * 3 + 1] * b.data[3 + col] + a.data[row * 3 + 2] * b.data[6 + col];
+
+	return m;
+}
+
+inline double length(const VECTOR3& v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+
+struct VESSELSTATUS2
+{
+	unsigned long version, flag;
+	OBJHANDLE rbody, base;
+	int port, status;
+	VECTOR3 rpos, rvel, vrot, arot;
+	double surf_lng, surf_lat, surf_hdg;
+	unsigned long nfuel;
+	void* fuel;
+	unsigned long nthruster;
+	void* thruster;
+	unsigned long ndockinfo;
+	void* dockinfo;
+	unsigned long xpdr;
+};
+
+struct ElevationTile;
+
+class VESSEL
+{
+public:
+	void GetStatusEx(void* status) const;
+};
+
+// Defined by each test, as needed
+void oapiWriteLogV(const char* format, ...);
+OBJHANDLE oapiGetVesselByName(char* name);
+double oapiGetSysTime();
+double oapiGetSize(OBJHANDLE hObj);
+double oapiSurfaceElevationEx(OBJHANDLE hPlanet, double lng, double lat, int reqlvl = 0, std::vector<ElevationTile>* tilecache = 0, VECTOR3* nml = 0, int* lvl = 0);
@@ -2,7 +2,6 @@
 #include "..\..\BaseCommon.h"
 
 #include <format>
-#include <sstream>
 
 DLLCLBK VESSEL* ovcInit(OBJHANDLE hVessel, int fModel) { return new UACS::Vessel::Astronaut(hVessel, fModel); }
 
@@ -32,6 +31,12 @@ namespace UACS
 				if (oapiReadItem_float(hConfig, "SearchRange", searchRange)) searchRange *= 1000;
 				else oapiWriteLog("UACS warning: Couldn't read SearchRange option from config file, will use default value (60)");
 
+				if (oapiReadItem_float(hConfig, "DetailRange", detailRange)) detailRange *= 1000;
+				else oapiWriteLog("UACS warning: Couldn't read DetailRange option from config file, will use default value (1)");
+
+				if (!oapiReadItem_float(hConfig, "HudRefreshRate", hudRefreshRate))
+					oapiWriteLog("UACS warning: Couldn't read HudRefreshRate option from config file, will use default value (10)");
+
 				oapiCloseFile(hConfig, FILE_IN_ZEROONFAIL);
 			}
 			else oapiWriteLog("UACS warning: Couldn't load config file, will use default config");
@@ -49,7 +54,7 @@ namespace UACS
 			lonSpeed.minLimit = latSpeed.minLimit = -(latSpeed.maxLimit = 1);
 			steerAngle.minLimit = -(steerAngle.maxLimit = 45 * RAD);
 
-			hudInfo.deadFont = oapiCreateFont(50, true, "Courier New");
+			if (!deadFontUsers++) deadFont = oapiCreateFont(50, true, "Courier New");
 
 			vslCargoInfo.astrMode = true;
 			vslCargoInfo.grappleRange = 5;
@@ -61,7 +66,7 @@ namespace UACS
 			hudInfo.message = std::format("UACS version: v{}", GetUACSVersion());
 		}
 
-		Astronaut::~Astronaut() { oapiReleaseFont(hudInfo.deadFont); }
+		Astronaut::~Astronaut() { if (!--deadFontUsers) oapiReleaseFont(deadFont); }
 
 		void Astronaut::clbkSetClassCaps(FILEHANDLE cfg)
 		{
@@ -161,38 +166,45 @@ namespace UACS
 
 			while (oapiReadScenario_nextline(scn, line))
 			{
-				std::istringstream ss(line);
-				std::string data;
+				UACS::ScenarioLine scnLine(line);
 
-				if (ss >> data >> std::ws)
+				switch (UACS::HashKey(scnLine.Next()))
 				{
-					if (data == "NAME") { std::getline(ss, data); astrInfo.name = data; }
+				case UACS::HashKey("NAME"): astrInfo.name = scnLine.Rest(); break;
 
-					else if (data == "ROLE") ss >> astrInfo.role;
+				case UACS::HashKey("ROLE"): scnLine.Read(astrInfo.role); break;
 
-					else if (data == "MASS") ss >> astrInfo.mass;
+				case UACS::HashKey("MASS"): scnLine.Read(astrInfo.mass); break;
 
-					else if (data == "ALIVE") ss >> astrInfo.alive;
+				case UACS::HashKey("ALIVE"): scnLine.Read(astrInfo.alive); break;
 
-					else if (data == "SUIT_ON") { ss >> suitOn; suitRead = true; }
+				case UACS::HashKey("SUIT_ON"): scnLine.Read(suitOn); suitRead = true; break;
 
-					else if (enableCockpit && data == "VISOR_STATE") ss >> visorAnim.state;
+				case UACS::HashKey("VISOR_STATE"):
+					if (enableCockpit) scnLine.Read(visorAnim.state);
+					break;
 
-					else if (enableCockpit && data == "VISOR_PROC") { ss >> visorAnim.proc; SetAnimation(visorAnim.id, visorAnim.proc); }
+				case UACS::HashKey("VISOR_PROC"):
+					if (enableCockpit) { scnLine.Read(visorAnim.proc); SetAnimation(visorAnim.id, visorAnim.proc); }
+					break;
 
-					else if (data == "HUD_MODE") ss >> hudInfo.mode;
+				case UACS::HashKey("HUD_MODE"): scnLine.Read(hudInfo.mode); break;
 
-					else if (spotLight && data == "HEADLIGHT") { bool active; ss >> active; SetHeadlight(active); }
+				case UACS::HashKey("HEADLIGHT"):
+					if (spotLight) { bool active{}; scnLine.Read(active); SetHeadlight(active); }
+					break;
 
-					else if (!mdlAPI.ParseScenarioLine(line)) ParseScenarioLineEx(line, status);
+				default:
+					if (!mdlAPI.ParseScenarioLine(line)) ParseScenarioLineEx(line, status);
 				}
-
-				else if (!mdlAPI.ParseScenarioLine(line)) ParseScenarioLineEx(line, status);
 			}
 		}
 
 		void Astronaut::clbkSaveState(FILEHANDLE scn)
 		{
+			// The oxygen tank is only written periodically by UACS
+			SetOxygenMass(GetOxygenMass());
+
 			VESSEL4::clbkSaveState(scn);
 			mdlAPI.clbkSaveState(scn);
 
@@ -240,14 +252,14 @@ namespace UACS
 
 			SetEmptyMass((suitOn ? suitMass : 0) + astrInfo.mass);
 			SetPropellantMass(hFuel, astrInfo.fuelLvl * GetPropellantMaxMass(hFuel));
-			SetPropellantMass(hOxy, astrInfo.oxyLvl * GetPropellantMaxMass(hOxy));
+			SetOxygenMass(astrInfo.oxyLvl * oxyMaxMass);
 
 			return true;
 		}
 
 		const UACS::AstrInfo* Astronaut::clbkGetAstrInfo()
 		{
-			// Oxygen level is set in SetOxygenConsumption
+			astrInfo.oxyLvl = GetOxygenMass() / oxyMaxMass;
 			astrInfo.fuelLvl = GetPropellantMass(hFuel) / GetPropellantMaxMass(hFuel);			
 
 			return &astrInfo;
@@ -257,6 +269,8 @@ namespace UACS
 		{
 			if (!astrInfo.alive || !down || !KEYMOD_ALT(kstate)) return 0;
 
+			hudInfo.refresh = true;
+
 			switch (hudInfo.mode)
 			{
 			case HUD_VSL:
@@ -265,13 +279,13 @@ namespace UACS
 				case OAPI_KEY_NUMPAD6:
 					if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
 
-					SetMapIdx(hudInfo.vslMap, true);
+					SetListIdx(hudInfo.vslList, true);
 					return 1;
 
 				case OAPI_KEY_NUMPAD4:
 					if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
 
-					SetMapIdx(hudInfo.vslMap, false);
+					SetListIdx(hudInfo.vslList, false);
 					return 1;
 
 				case OAPI_KEY_NUMPAD3:
@@ -302,6 +316,15 @@ namespace UACS
 					hudInfo.drainFuel = !hudInfo.drainFuel;
 					return 1;
 
+				case OAPI_KEY_W:
+					if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
+
+					if (traverse.active) { traverse.active = false; hudInfo.message = "Success: Walking stopped."; }
+					else StartTraverse();
+
+					hudInfo.timer = 0;
+					return 1;
+
 				case OAPI_KEY_F:
 				{
 					if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
@@ -310,7 +333,7 @@ namespace UACS
 					double reqMass;
 
 					if (hudInfo.drainFuel) { resource = "fuel"; reqMass = GetPropellantMaxMass(hFuel) - GetPropellantMass(hFuel); }
-					else { resource = "oxygen"; reqMass = GetPropellantMaxMass(hOxy) - GetPropellantMass(hOxy); }
+					else { resource = "oxygen"; reqMass = oxyMaxMass - GetOxygenMass(); }
 
 					if (reqMass)
 					{
@@ -320,7 +343,7 @@ namespace UACS
 						{
 						case UACS::DRIN_SUCCED:
 							if (hudInfo.drainFuel) SetPropellantMass(hFuel, GetPropellantMass(hFuel) + drainInfo.second);
-							else SetPropellantMass(hOxy, GetPropellantMass(hOxy) + drainInfo.second);
+							else SetOxygenMass(GetOxygenMass() + drainInfo.second);
 
 							hudInfo.message = std::format("Success: {:g} kg {} drained.", drainInfo.second, resource);
 							break;
@@ -449,8 +472,8 @@ namespace UACS
 			{
 				if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
 
-				if (key == OAPI_KEY_NUMPAD6) SetMapIdx(hudInfo.astrMap, true);
-				else if (key == OAPI_KEY_NUMPAD4) SetMapIdx(hudInfo.astrMap, false);
+				if (key == OAPI_KEY_NUMPAD6) SetListIdx(hudInfo.astrList, true);
+				else if (key == OAPI_KEY_NUMPAD4) SetListIdx(hudInfo.astrList, false);
 				else break;
 
 				return 1;
@@ -473,16 +496,7 @@ namespace UACS
 				{
 					if (!oapiCameraInternal() || oapiGetHUDMode() == HUD_NONE) return 0;
 
-					if (mdlAPI.GetScnCargoCount())
-					{
-						do
-						{
-							if (key == OAPI_KEY_NUMPAD6) hudInfo.vslIdx + 1 < mdlAPI.GetScnCargoCount() ? ++hudInfo.vslIdx : hudInfo.vslIdx = 0;
-							else hudInfo.vslIdx > 0 ? --hudInfo.vslIdx : hudInfo.vslIdx = mdlAPI.GetScnCargoCount() - 1;
-						} while (mdlAPI.GetCargoInfoByIndex(hudInfo.vslIdx).attached);
-
-						hudInfo.hVessel = mdlAPI.GetCargoInfoByIndex(hudInfo.vslIdx).handle;
-					}
+					SetListIdx(hudInfo.cargoList, key == OAPI_KEY_NUMPAD6);
 
 					return 1;
 				}
@@ -618,7 +632,7 @@ namespace UACS
 					double reqMass;
 
 					if (hudInfo.drainFuel) { resource = "fuel"; reqMass = GetPropellantMaxMass(hFuel) - GetPropellantMass(hFuel); }
-					else { resource = "oxygen"; reqMass = GetPropellantMaxMass(hOxy) - GetPropellantMass(hOxy); }
+					else { resource = "oxygen"; reqMass = oxyMaxMass - GetOxygenMass(); }
 
 					if (reqMass)
 					{
@@ -628,7 +642,7 @@ namespace UACS
 						{
 						case UACS::DRIN_SUCCED:
 							if (hudInfo.drainFuel) SetPropellantMass(hFuel, GetPropellantMass(hFuel) + drainInfo.second);
-							else SetPropellantMass(hOxy, GetPropellantMass(hOxy) + drainInfo.second);
+							else SetOxygenMass(GetOxygenMass() + drainInfo.second);
 
 							hudInfo.message = std::format("Success: {:g} kg {} drained.", drainInfo.second, resource);
 							break;
@@ -739,7 +753,9 @@ namespace UACS
 
 		void Astronaut::clbkPreStep(double simt, double simdt, double mjd)
 		{
-			if (astrInfo.alive) SetOxygenConsumption(simdt);
+			if (astrInfo.alive && SkipStep(simdt)) return;
+
+			if (astrInfo.alive) SetOxygenConsumption();
 
 			if (!astrInfo.alive) 
 			{
@@ -765,7 +781,9 @@ namespace UACS
 
 				if (surfInfo.ref != GetSurfaceRef()) SetSurfaceRef();
 
-				if (lonSpeed.value || latSpeed.value || steerAngle.value) SetGroundMovement(simdt);
+				if (lonSpeed.value || latSpeed.value || steerAngle.value) { traverse.active = false; SetGroundMovement(simdt); }
+
+				else if (traverse.active) SetTraverse();
 
 				avgForce = forceStep = 0;
 			}
@@ -775,6 +793,8 @@ namespace UACS
 
 				SetLandedStatus();
 
+				traverse.active = false;
+
 				lonSpeed.value = latSpeed.value = steerAngle.value = 0;
 			}
 
@@ -791,51 +811,72 @@ namespace UACS
 			{
 				skp->SetTextColor(0x0000ff);
 				skp->SetTextAlign(oapi::Sketchpad::CENTER, oapi::Sketchpad::BOTTOM);
-				skp->SetFont(hudInfo.deadFont);
+				skp->SetFont(deadFont);
 
 				skp->Text(hps->CX, hps->CY, "DEAD", 4);
 				return true;
 			}
 
-			int x = HIWORD(skp->GetCharSize());
-			hudInfo.rightX = hps->W - x;
-			int y = hudInfo.startY = int(0.212 * hps->H);
+			// The HUD model is computed at the refresh rate, or at once if a key was pressed or the layout changed
+			if (hudLayout.Set(hps, skp, 0.212))
+			{
+				hudInfo.refresh = true;
+				hudInfo.shortPage = {};
+			}
 
-			hudInfo.space = LOWORD(skp->GetCharSize());
-			hudInfo.smallSpace = int(0.5 * hudInfo.space);
-			hudInfo.largeSpace = int(1.5 * hudInfo.space);
+			const bool showMessage = hudInfo.timer < 5;
 
-			if (hudInfo.timer < 5)
+			if (const double sysTime = oapiGetSysTime(); hudInfo.refresh || sysTime >= hudInfo.refreshTime || showMessage != hudInfo.showMessage)
 			{
-				skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+				hudInfo.refresh = false;
+				hudInfo.refreshTime = sysTime + 1 / hudRefreshRate;
+				hudInfo.showMessage = showMessage;
 
-				skp->Text(hudInfo.rightX, hudInfo.startY, hudInfo.message.c_str(), hudInfo.message.size());
-				hudInfo.startY += hudInfo.largeSpace;
+				SetHudModel();
+			}
 
+			if (showMessage)
+			{
+				skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+				skp->Text(hudLayout.rightX, hudLayout.startY, hudInfo.message.c_str(), hudInfo.message.size());
 				skp->SetTextAlign(oapi::Sketchpad::LEFT);
 			}
 
-			buffer = astrInfo.role;
-			buffer[0] = std::toupper(buffer[0]);
-			buffer = std::format("Name: {} - Role: {}", astrInfo.name, buffer);
+			hudRecorder.Draw(skp);
+
+			if (hudInfo.mode == HUD_SRT1 || hudInfo.mode == HUD_SRT2) shortRecorder.Draw(skp);
+
+			return true;
+		}
+
+		void Astronaut::SetHudModel()
+		{
+			hudRecorder.Clear();
+			hudCache.Begin();
 
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			oapi::Sketchpad* skp = &hudRecorder;
+
+			int x = hudLayout.leftX;
+			int y = hudInfo.startY = hudLayout.startY;
+
+			if (hudInfo.showMessage) hudInfo.startY += hudLayout.largeSpace;
+
+			hudCache.Text(skp, x, y, "Name: {} - Role: {}", astrInfo.name, UACS::Capitalized{ astrInfo.role });
+			y += hudLayout.space;
 
 			if (suitOn)
 			{
-				const double time = GetPropellantMass(hOxy) / (consumptionRate * 3600);
+				const double time = GetOxygenMass() / (consumptionRate * 3600);
 				const int hours = int(time);
 				const double minutesRemainder = (time - hours) * 60;
 				const int minutes = int(minutesRemainder);
 				const int seconds = int((minutesRemainder - minutes) * 60);
 
-				buffer = std::format("Oxygen Level: {:.1f}% - Duration: {:02d}:{:02d}:{:02d}", astrInfo.oxyLvl * 100, hours, minutes, seconds);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Oxygen Level: {:.1f}% - Duration: {:02d}:{:02d}:{:02d}", astrInfo.oxyLvl * 100, hours, minutes, seconds);
+				y += hudLayout.space;
 			}
 			
-			y += hudInfo.smallSpace;
+			y += hudLayout.smallSpace;
 
 			switch (hudInfo.mode)
 			{
@@ -856,15 +897,18 @@ namespace UACS
 				break;
 
 			case HUD_SRT1:
-				DrawShort1HUD(x, y, skp);
-				break;
-
 			case HUD_SRT2:
-				DrawShort2HUD(x, y, skp);
+				// Shortcut pages are static, so they're only laid out again if their position changes
+				if (hudInfo.shortPage.mode == hudInfo.mode && hudInfo.shortPage.leftY == y && hudInfo.shortPage.rightY == hudInfo.startY) break;
+
+				hudInfo.shortPage = { hudInfo.mode, y, hudInfo.startY };
+				shortRecorder.Clear();
+
+				if (hudInfo.mode == HUD_SRT1) DrawShort1HUD(x, y, &shortRecorder);
+				else DrawShort2HUD(x, y, &shortRecorder);
+
 				break;
 			}
-
-			return true;
 		}
 
 		void Astronaut::InitPropellant()
@@ -945,14 +989,41 @@ namespace UACS
 			CreateThrusterGroup(thRCS + 13, 1, THGROUP_ATT_BACK);
 
 			astrInfo.fuelLvl = GetPropellantMass(hFuel) / GetPropellantMaxMass(hFuel);
-			astrInfo.oxyLvl = GetPropellantMass(hOxy) / GetPropellantMaxMass(hOxy);
+			SetOxygenTank(hOxy);
+			oxyMaxMass = GetPropellantMaxMass(hOxy);
+			astrInfo.oxyLvl = GetOxygenMass() / oxyMaxMass;
 		}
 
-		void Astronaut::SetOxygenConsumption(double simdt)
+		bool Astronaut::SkipStep(double& simdt)
+		{
+			lodTimer += simdt;
+
+			// Full detail is kept while focused, moving, flying or animating the visor
+			if (GetFlightStatus() && !lonSpeed.value && !latSpeed.value && !steerAngle.value && !visorAnim.state && oapiGetFocusObject() != GetHandle())
+			{
+				if (lodTimer < lodNearInterval) return true;
+
+				if (lodTimer < lodFarInterval)
+				{
+					VECTOR3 relPos;
+					GetRelativePos(oapiGetFocusObject(), relPos);
+
+					if (length(relPos) > detailRange) return true;
+				}
+			}
+
+			// The skipped steps are done as one step
+			simdt = lodTimer;
+			lodTimer = 0;
+
+			return false;
+		}
+
+		void Astronaut::SetOxygenConsumption()
 		{
 			if (suitOn)
 			{
-				const double speed = abs(lonSpeed.value) + abs(latSpeed.value) + abs(steerAngle.value) / PI;
+				const double speed = abs(lonSpeed.value) + abs(latSpeed.value) + abs(steerAngle.value) / PI + (traverse.active ? traverse.speed : 0);
 
 				if (speed > 2.7) consumptionRate = speed * 3.233e-5;
 				else if (speed) consumptionRate = speed * (1.079e-5 * speed + 3.233e-6);
@@ -960,19 +1031,24 @@ namespace UACS
 
 				consumptionRate += 9.43e-6;
 
-				double oxyMass = GetPropellantMass(hOxy) - (consumptionRate * simdt);
-
-				if (oxyMass > 0) { SetPropellantMass(hOxy, oxyMass); astrInfo.oxyLvl = oxyMass / GetPropellantMaxMass(hOxy); }
-				else
-				{
-					SetPropellantMass(hOxy, 0);
-					astrInfo.oxyLvl = 0;
+				// The oxygen is consumed by UACS, which calls clbkOxygenDepleted when it runs out
+				SetOxygenRate(consumptionRate);
+				astrInfo.oxyLvl = GetOxygenMass() / oxyMaxMass;
+			}
+			else
+			{
+				SetOxygenRate(0);
 
-					if (InBreathable()) { mdlAPI.ReleaseCargo(0); SetSuit(false, false); }
-					else Kill(GetFlightStatus());
-				}
+				if (!InBreathable()) Kill(GetFlightStatus());
 			}
-			else if (!InBreathable()) Kill(GetFlightStatus());
+		}
+
+		void Astronaut::clbkOxygenDepleted()
+		{
+			astrInfo.oxyLvl = 0;
+
+			if (InBreathable()) { mdlAPI.ReleaseCargo(0); SetSuit(false, false); }
+			else Kill(GetFlightStatus());
 		}
 
 		void Astronaut::SetLandedStatus()
@@ -1032,11 +1108,16 @@ namespace UACS
 		{
 			VESSELSTATUS2 status = GetVesselStatus(this);
 
-			if (steerAngle.value) status.surf_hdg = fmod(status.surf_hdg + steerAngle.value * simdt, PI2);
+			// Speed and steering are constant over the step, so the path is a circular arc. Moving along its chord
+			// with the heading halfway through the turn ends exactly on the arc, however large the time step is.
+			const double halfTurn = 0.5 * steerAngle.value * simdt;
+			const double chordRatio = abs(halfTurn) > 1e-9 ? sin(halfTurn) / halfTurn : 1;
+
+			if (halfTurn) status.surf_hdg = fmod(fmod(status.surf_hdg + halfTurn, PI2) + PI2, PI2);
 
 			if (lonSpeed.value)
 			{
-				SetLngLatHdg(lonSpeed.value * simdt, 0, status);
+				SetLngLatHdg(lonSpeed.value * simdt * chordRatio, 0, status);
 
 				if (enhancedMovements && lonSpeed.value > 1.55)
 				{
@@ -1046,7 +1127,9 @@ namespace UACS
 				else lonSpeed.maxLimit = 10;
 			}
 
-			else if (latSpeed.value) SetLngLatHdg(latSpeed.value * simdt, PI05, status);
+			else if (latSpeed.value) SetLngLatHdg(latSpeed.value * simdt * chordRatio, PI05, status);
+
+			if (halfTurn) status.surf_hdg = fmod(fmod(status.surf_hdg + halfTurn, PI2) + PI2, PI2);
 
 			SetGroundRotation(status, astrInfo.height);
 
@@ -1058,6 +1141,15 @@ namespace UACS
 			distance /= oapiGetSize(surfInfo.ref);
 
 			double hdg = fmod(status.surf_hdg + hdgOffset, PI2);
+
+			if (UseTangentPlane(distance, status.surf_lat))
+			{
+				// The heading is kept, as the exact path below sets it to the initial bearing
+				status.surf_lng += distance * sin(hdg) / cos(status.surf_lat);
+				status.surf_lat += distance * cos(hdg);
+				return;
+			}
+
 			double finalLat = asin(sin(status.surf_lat) * cos(distance) + cos(status.surf_lat) * sin(distance) * cos(hdg));
 			double lngOffset = atan2(sin(hdg) * sin(distance) * cos(status.surf_lat), cos(distance) - sin(status.surf_lat) * sin(finalLat));
 			double finalLng = status.surf_lng + lngOffset;
@@ -1076,6 +1168,85 @@ namespace UACS
 			status.surf_lat = finalLat;
 		}
 
+		void Astronaut::StartTraverse()
+		{
+			if (!GetFlightStatus()) { hudInfo.message = "Error: Astronaut not on ground."; return; }
+
+			if (!hudInfo.hVessel || !oapiIsVessel(hudInfo.hVessel)) { hudInfo.message = "Error: No vessel selected."; return; }
+
+			VECTOR3 tgtPos;
+			double stopDist;
+
+			// Walks to the selected airlock if the vessel has airlocks, or next to the vessel if not
+			if (hudInfo.vslInfo.info && !hudInfo.vslInfo.info->airlocks.empty())
+			{
+				const auto& airlockInfo = hudInfo.vslInfo.info->airlocks.at(hudInfo.vslInfo.arlckIdx);
+
+				oapiLocalToGlobal(hudInfo.hVessel, &airlockInfo.pos, &tgtPos);
+				stopDist = 0.5 * airlockInfo.range;
+			}
+			else
+			{
+				oapiGetGlobalPos(hudInfo.hVessel, &tgtPos);
+				stopDist = oapiGetSize(hudInfo.hVessel) + 1;
+			}
+
+			double tgtLng, tgtLat, tgtRad;
+			oapiGlobalToEqu(surfInfo.ref, tgtPos, &tgtLng, &tgtLat, &tgtRad);
+
+			const VESSELSTATUS2 status = GetVesselStatus(this);
+			const double bodySize = oapiGetSize(surfInfo.ref);
+			const double distance = DistLngLat(bodySize, status.surf_lng, status.surf_lat, tgtLng, tgtLat) - stopDist;
+
+			if (distance <= 0) { hudInfo.message = "Error: Selected target in range."; return; }
+
+			const double lngOffset = tgtLng - status.surf_lng;
+
+			traverse.active = true;
+			traverse.startTime = oapiGetSimTime();
+			traverse.startLng = status.surf_lng;
+			traverse.startLat = status.surf_lat;
+			traverse.hdg = atan2(sin(lngOffset) * cos(tgtLat), cos(status.surf_lat) * sin(tgtLat) - sin(status.surf_lat) * cos(tgtLat) * cos(lngOffset));
+			traverse.angle = distance / bodySize;
+			traverse.speed = lonSpeed.maxSlowLimit;
+
+			hudInfo.message = std::format("Success: Walking {:.0f}m to selected target.", distance);
+		}
+
+		void Astronaut::SetTraverse()
+		{
+			const double bodySize = oapiGetSize(surfInfo.ref);
+			const double angle = min(traverse.speed * (oapiGetSimTime() - traverse.startTime) / bodySize, traverse.angle);
+
+			const double sinLat = sin(traverse.startLat), cosLat = cos(traverse.startLat);
+
+			VESSELSTATUS2 status = GetVesselStatus(this);
+
+			status.surf_lat = asin(sinLat * cos(angle) + cosLat * sin(angle) * cos(traverse.hdg));
+
+			const double lngOffset = atan2(sin(traverse.hdg) * sin(angle) * cosLat, cos(angle) - sinLat * sin(status.surf_lat));
+			status.surf_lng = traverse.startLng + lngOffset;
+
+			// The heading along the great circle, which is the reverse of the bearing to the start point
+			if (angle > 1e-9)
+			{
+				const double backHdg = atan2(-sin(lngOffset) * cosLat, cos(status.surf_lat) * sinLat - sin(status.surf_lat) * cosLat * cos(lngOffset));
+				status.surf_hdg = fmod(backHdg + PI + PI2, PI2);
+			}
+			else status.surf_hdg = fmod(traverse.hdg + PI2, PI2);
+
+			SetGroundRotation(status, astrInfo.height);
+			DefSetStateEx(&status);
+
+			if (angle >= traverse.angle)
+			{
+				traverse.active = false;
+
+				hudInfo.message = "Success: Arrived at selected target.";
+				hudInfo.timer = 0;
+			}
+		}
+
 		void Astronaut::SetDefaultValues()
 		{
 			lonSpeed.maxSlowLimit = lonSpeed.maxMinRate = latSpeed.maxMinRate = 1.55;
@@ -1215,6 +1386,8 @@ namespace UACS
 
 		void Astronaut::Kill(bool isLanded)
 		{
+			SetOxygenRate(0);
+
 			if (spotLight) SetHeadlight(false);
 
 			astrInfo.alive = false;
@@ -1241,7 +1414,7 @@ namespace UACS
 		void Astronaut::DrawNearHUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "Nearest airlock information", 27);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			auto nearAirlock = GetNearestAirlock(searchRange);
 
@@ -1255,51 +1428,45 @@ namespace UACS
 
 			hudInfo.vslInfo.info = GetVslAstrInfo(hudInfo.hVessel);
 
-			buffer = std::format("Vessel name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Vessel name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
+			y += hudLayout.space;
 
-			buffer = std::format("Station count: {}", hudInfo.vslInfo.info->stations.size());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Station count: {}", hudInfo.vslInfo.info->stations.size());
+			y += hudLayout.space;
 
 			{
 				const auto& stationInfo = hudInfo.vslInfo.info->stations.at(hudInfo.vslInfo.statIdx);
 
-				buffer = std::format("Selected station name: {}, {}", stationInfo.name, stationInfo.astrInfo ? "occupied" : "empty");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected station name: {}, {}", stationInfo.name, stationInfo.astrInfo ? "occupied" : "empty");
+				y += hudLayout.space;
 			}
 
-			buffer = std::format("Airlock name: {}, {}", nearAirlock->airlockInfo.name, nearAirlock->airlockInfo.open ? "open" : "closed");
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Airlock name: {}, {}", nearAirlock->airlockInfo.name, nearAirlock->airlockInfo.open ? "open" : "closed");
+			y += hudLayout.space;
 
-			buffer = std::format("Airlock ingress range: {:.1f}m", nearAirlock->airlockInfo.range);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Airlock ingress range: {:.1f}m", nearAirlock->airlockInfo.range);
+			y += hudLayout.space;
 
 			DrawVslInfo(x, y, skp, nearAirlock->airlockInfo.pos);
 
 		breathLabel:
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
 			skp->Text(x, y, "Nearest breathable information", 30);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			OBJHANDLE hVessel = GetNearestBreathable(searchRange).first;
 
 			if (!hVessel) { skp->Text(x, y, "No breathable in range", 22); goto actionLabel; }
 
-			buffer = std::format("Vessel name: {}", oapiGetVesselInterface(hVessel)->GetName());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Vessel name: {}", oapiGetVesselInterface(hVessel)->GetName());
+			y += hudLayout.space;
 
-			buffer = mdlAPI.GetCargoInfoByHandle(hVessel) ? "Type: Cargo" : "Type: Station";
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			if (mdlAPI.GetCargoInfoByHandle(hVessel)) skp->Text(x, y, "Type: Cargo", 11);
+			else skp->Text(x, y, "Type: Station", 13);
+			y += hudLayout.space;
 
 			VECTOR3 relPos;
 			oapiGetGlobalPos(hVessel, &relPos);
@@ -1307,10 +1474,10 @@ namespace UACS
 			DrawVslInfo(x, y, skp, relPos);
 
 		actionLabel:
-			y += hudInfo.largeSpace;
+			y += hudLayout.largeSpace;
 
 			skp->Text(x, y, "Nearest action area information", 31);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			auto nearAction = GetNearestAction(searchRange);
 
@@ -1319,17 +1486,14 @@ namespace UACS
 			hudInfo.hVslAction = nearAction->hVessel;
 			hudInfo.vslInfo.actionIdx = nearAction->actionIdx;
 
-			buffer = std::format("Vessel name: {}", oapiGetVesselInterface(hudInfo.hVslAction)->GetName());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Vessel name: {}", oapiGetVesselInterface(hudInfo.hVslAction)->GetName());
+			y += hudLayout.space;
 
-			buffer = std::format("Action area name: {}", nearAction->actionInfo.name);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Action area name: {}", nearAction->actionInfo.name);
+			y += hudLayout.space;
 
-			buffer = std::format("Action area trigger range: {:.1f}m", nearAction->actionInfo.range);
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Action area trigger range: {:.1f}m", nearAction->actionInfo.range);
+			y += hudLayout.space;
 
 			DrawVslInfo(x, y, skp, nearAction->actionInfo.pos);
 		}
@@ -1337,23 +1501,14 @@ namespace UACS
 		void Astronaut::DrawVslHUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "Scenario vessel information", 27);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			SetVslMap();
+			SetVslList();
 
-			if (hudInfo.vslMap.empty()) { skp->Text(x, y, "No vessel in range", 18); return; }
+			if (hudInfo.vslList.empty()) { skp->Text(x, y, "No vessel in range", 18); return; }
 
-			if (hudInfo.hVessel) 
+			if (SetListSelection(hudInfo.vslList))
 			{
-				auto vslIt = hudInfo.vslMap.find(hudInfo.vslIdx);
-
-				if (vslIt == hudInfo.vslMap.end() || vslIt->second != hudInfo.hVessel) hudInfo.hVessel = nullptr;
-			}
-
-			if (!hudInfo.hVessel)
-			{
-				hudInfo.vslIdx = hudInfo.vslMap.begin()->first;
-				hudInfo.hVessel = hudInfo.vslMap.begin()->second;
 				hudInfo.vslInfo = HudInfo::VesselInfo();
 
 				if (auto resources = mdlAPI.GetStationResources(hudInfo.hVessel))
@@ -1374,13 +1529,11 @@ namespace UACS
 				}
 			}
 
-			buffer = std::format("Vessel count: {}", hudInfo.vslMap.size());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Vessel count: {}", hudInfo.vslList.size());
+			y += hudLayout.space;
 
-			buffer = std::format("Selected vessel name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Selected vessel name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
+			y += hudLayout.space;
 
 			hudInfo.vslInfo.info = GetVslAstrInfo(hudInfo.hVessel);
 
@@ -1393,29 +1546,24 @@ namespace UACS
 			}
 			else
 			{
-				buffer = std::format("Station count: {}", hudInfo.vslInfo.info->stations.size());
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Station count: {}", hudInfo.vslInfo.info->stations.size());
+				y += hudLayout.space;
 
 				const auto& stationInfo = hudInfo.vslInfo.info->stations.at(hudInfo.vslInfo.statIdx);
 
-				buffer = std::format("Selected station name: {}, {}", stationInfo.name, stationInfo.astrInfo ? "occupied" : "empty");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected station name: {}, {}", stationInfo.name, stationInfo.astrInfo ? "occupied" : "empty");
+				y += hudLayout.space;
 
-				buffer = std::format("Airlock count: {}", hudInfo.vslInfo.info->airlocks.size());
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Airlock count: {}", hudInfo.vslInfo.info->airlocks.size());
+				y += hudLayout.space;
 
 				const auto& airlockInfo = hudInfo.vslInfo.info->airlocks.at(hudInfo.vslInfo.arlckIdx);
 
-				buffer = std::format("Selected airlock name: {}, {}", airlockInfo.name, airlockInfo.open ? "open" : "closed");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected airlock name: {}, {}", airlockInfo.name, airlockInfo.open ? "open" : "closed");
+				y += hudLayout.space;
 
-				buffer = std::format("Selected airlock ingress range: {:.1f}m", airlockInfo.range);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected airlock ingress range: {:.1f}m", airlockInfo.range);
+				y += hudLayout.space;
 
 				VECTOR3 airlockPos;
 				oapiLocalToGlobal(hudInfo.hVessel, &airlockInfo.pos, &airlockPos);
@@ -1423,7 +1571,7 @@ namespace UACS
 				DrawVslInfo(x, y, skp, airlockPos);
 			}
 
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
@@ -1431,120 +1579,89 @@ namespace UACS
 			{
 				hudInfo.hVslAction = hudInfo.hVessel;
 
-				buffer = std::format("Action area count: {}", hudInfo.vslInfo.info->actionAreas.size());
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Action area count: {}", hudInfo.vslInfo.info->actionAreas.size());
+				y += hudLayout.space;
 
 				const auto& actionInfo = hudInfo.vslInfo.info->actionAreas.at(hudInfo.vslInfo.actionIdx);
 
-				buffer = std::format("Selected action area name: {}, {}", actionInfo.name, actionInfo.enabled ? "enabled" : "disabled");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected action area name: {}, {}", actionInfo.name, actionInfo.enabled ? "enabled" : "disabled");
+				y += hudLayout.space;
 
-				buffer = std::format("Selected action area trigger range: {:.1f}m", actionInfo.range);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Selected action area trigger range: {:.1f}m", actionInfo.range);
+				y += hudLayout.space;
 
 				VECTOR3 actionPos;
 				oapiLocalToGlobal(hudInfo.hVessel, &actionInfo.pos, &actionPos);
 				Global2Local(actionPos, actionPos);
 				DrawVslInfo(x, y, skp, actionPos);
 
-				y += hudInfo.largeSpace;
+				y += hudLayout.largeSpace;
 			}
 
 			if (hudInfo.vslInfo.resources)
 			{
-				buffer = std::format("Selected resource to drain: {}", hudInfo.drainFuel ? "Fuel" : "Oxygen");
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
-
-				if (hudInfo.vslInfo.resources->empty()) buffer = "Selected vessel resources: All";
-				else buffer = std::format("Selected vessel resources: {}", *hudInfo.vslInfo.resources);
+				hudCache.Text(skp, x, y, "Selected resource to drain: {}", hudInfo.drainFuel ? "Fuel" : "Oxygen");
+				y += hudLayout.space;
 
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				if (hudInfo.vslInfo.resources->empty()) skp->Text(x, y, "Selected vessel resources: All", 30);
+				else hudCache.Text(skp, x, y, "Selected vessel resources: {}", *hudInfo.vslInfo.resources);
 			}
 		}
 
 		void Astronaut::DrawAstrHUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "Scenario astronaut information", 30);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			SetAstrMap();
+			SetAstrList();
 
-			if (hudInfo.astrMap.empty()) { skp->Text(x, y, "No astronaut in range", 21); return; }
+			if (hudInfo.astrList.empty()) { skp->Text(x, y, "No astronaut in range", 21); return; }
 
-			buffer = std::format("Astronaut count: {}", hudInfo.astrMap.size());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Astronaut count: {}", hudInfo.astrList.size());
+			y += hudLayout.space;
 
-			if (hudInfo.hVessel)
-			{
-				auto astrIt = hudInfo.astrMap.find(hudInfo.vslIdx);
+			SetListSelection(hudInfo.astrList);
 
-				if (astrIt == hudInfo.astrMap.end() || astrIt->second != hudInfo.hVessel) hudInfo.hVessel = nullptr;
-			}
-
-			if (!hudInfo.hVessel)
-			{
-				hudInfo.vslIdx = hudInfo.astrMap.begin()->first;
-				hudInfo.hVessel = hudInfo.astrMap.begin()->second;
-			}
-
-			buffer = std::format("Selected astronaut name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Selected astronaut name: {}", oapiGetVesselInterface(hudInfo.hVessel)->GetName());
+			y += hudLayout.space;
 
 			VECTOR3 relPos;
 			oapiGetGlobalPos(hudInfo.hVessel, &relPos);
 			Global2Local(relPos, relPos);
 			DrawVslInfo(x, y, skp, relPos);
 
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
 			skp->Text(x, y, "Selected astronaut information", 30);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			mdlAPI.DrawAstrInfo(*GetAstrInfoByIndex(hudInfo.vslIdx).second, skp, x, y, hudInfo.space);
+			mdlAPI.DrawAstrInfo(*GetAstrInfoByIndex(hudInfo.vslIdx).second, skp, x, y, hudLayout.space);
 		}
 
 		void Astronaut::DrawCargoHUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "Scenario cargo information", 26);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			SetCargoMap();
+			SetCargoList();
 
 			bool cargoRes{};
 
-			if (hudInfo.cargoMap.empty()) skp->Text(x, y, "No free cargo in range", 22);
+			if (hudInfo.cargoList.empty()) skp->Text(x, y, "No free cargo in range", 22);
 
 			else
 			{
-				buffer = std::format("Cargo count: {}", hudInfo.cargoMap.size());
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
-
-				if (hudInfo.hVessel)
-				{
-					auto cargoIt = hudInfo.cargoMap.find(hudInfo.vslIdx);
+				hudCache.Text(skp, x, y, "Cargo count: {}", hudInfo.cargoList.size());
+				y += hudLayout.space;
 
-					if (cargoIt == hudInfo.cargoMap.end() || cargoIt->second != hudInfo.hVessel) hudInfo.hVessel = nullptr;
-				}
-
-				if (!hudInfo.hVessel)
-				{
-					hudInfo.vslIdx = hudInfo.cargoMap.begin()->first;
-					hudInfo.hVessel = hudInfo.cargoMap.begin()->second;
-				}
+				SetListSelection(hudInfo.cargoList);
 
 				auto cargoInfo = mdlAPI.GetCargoInfoByIndex(hudInfo.vslIdx);
 
 				DrawCargoInfo(x, y, skp, cargoInfo, true);
-				y += hudInfo.space;
+				y += hudLayout.space;
 
 				oapiLocalToGlobal(cargoInfo.handle, &cargoInfo.attachPos, &cargoInfo.attachPos);
 				Global2Local(cargoInfo.attachPos, cargoInfo.attachPos);
@@ -1553,180 +1670,176 @@ namespace UACS
 				cargoRes = cargoInfo.resource.has_value();
 			}
 
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
 			if (cargoRes)
 			{
-				buffer = std::format("Selected resource to drain: {}", hudInfo.drainFuel ? "Fuel" : "Oxygen");
-				skp->Text(x, y, buffer.c_str(), buffer.size());				
-				y += hudInfo.largeSpace;
+				hudCache.Text(skp, x, y, "Selected resource to drain: {}", hudInfo.drainFuel ? "Fuel" : "Oxygen");				
+				y += hudLayout.largeSpace;
 			}
 
 			if (const auto& cargoInfo = vslCargoInfo.slots.front().cargoInfo)
 			{
 				skp->Text(x, y, "Grappled cargo information", 26);
-				y += hudInfo.space;
+				y += hudLayout.space;
 
-				mdlAPI.DrawCargoInfo(*cargoInfo, skp, x, y, hudInfo.space);
+				mdlAPI.DrawCargoInfo(*cargoInfo, skp, x, y, hudLayout.space);
 			}
 		}
 
 		void Astronaut::DrawShort1HUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "General shortcuts", 17);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + M: Cycle custom HUD modes", 31);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + S: Toggle suit", 20);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			if (enableCockpit) { skp->Text(x, y, "Alt + V: Toggle visor", 21); y += hudInfo.space; }
+			if (enableCockpit) { skp->Text(x, y, "Alt + V: Toggle visor", 21); y += hudLayout.space; }
 
-			if (spotLight) { skp->Text(x, y, "Alt + L: Toggle headlight", 25); y += hudInfo.space; }
-			y += hudInfo.smallSpace;
+			if (spotLight) { skp->Text(x, y, "Alt + L: Toggle headlight", 25); y += hudLayout.space; }
+			y += hudLayout.smallSpace;
 
 			skp->Text(x, y, "(Ctrl) Numpad 8/2: Move forward/backward (slowly)", 49);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "(Ctrl) Numpad 6/4: Turn right/left (slowly)", 43);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "(Ctrl) Numpad 3/1: Move right/left (slowly)", 43);
 
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
 			skp->Text(x, y, "Vessel HUD shortcuts", 20);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 6/4: Select next/previous vessel", 45);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 3/1: Select next/previous airlock", 46);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 8/2: Select next/previous station", 46);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 9/7: Select next/previous action area", 50);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + I: Ingress into selected station", 38);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + A: Trigger selected action area", 37);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + T: Select resource to drain", 33);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + F = Drain resource from selected station", 46);
+			y += hudLayout.space;
+
+			skp->Text(x, y, "Alt + W: Walk to selected airlock or vessel", 43);
 		}
 
 		void Astronaut::DrawShort2HUD(int x, int y, oapi::Sketchpad* skp)
 		{
 			skp->Text(x, y, "Nearest HUD shortcuts", 21);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 8/2: Select next/previous station", 46);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + I: Ingress into selected station", 38);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + A: Trigger nearest action area", 36);
-			y += hudInfo.largeSpace;
+			y += hudLayout.largeSpace;
 
 			skp->Text(x, y, "Astronaut HUD shortcuts", 23);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 6/4: Select next/previous astronaut", 48);
 
-			x = hudInfo.rightX;
+			x = hudLayout.rightX;
 			y = hudInfo.startY;
 			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
 			skp->Text(x, y, "Cargo HUD shortcuts", 19);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + Numpad 6/4: Select next/previous cargo", 44);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + T: Select resource to drain", 33);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + R = Release grappled cargo", 32);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + D = Delete grappled cargo", 31);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + G = Grapple nearest cargo", 31);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Ctrl + Alt + G = Grapple selected cargo", 39);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + P = Pack nearest packable cargo", 37);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Ctrl + Alt + P = Pack selected cargo", 36);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + U = Unpack nearest unpackable cargo", 41);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Ctrl + Alt + U = Unpack selected cargo", 38);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Alt + F = Drain resource from nearest cargo", 43);
-			y += hudInfo.space;
+			y += hudLayout.space;
 
 			skp->Text(x, y, "Ctrl + Alt + F = Drain resource from selected cargo", 51);
 		}
 
 		void Astronaut::DrawVslInfo(int x, int& y, oapi::Sketchpad* skp, VECTOR3 relPos)
 		{
-			buffer = std::format("Distance: {:.1f}m", length(relPos));
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Distance: {:.1f}m", length(relPos));
+			y += hudLayout.space;
 
 			double relYaw = atan2(relPos.x, relPos.z) * DEG;
 
 			if (GetFlightStatus())
 			{
-				buffer = std::format("Relative heading: {:.1f}", relYaw);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				hudCache.Text(skp, x, y, "Relative heading: {:.1f}", relYaw);
 			}
 
 			else
 			{
-				buffer = std::format("Relative yaw: {:.1f}", relYaw);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
-				y += hudInfo.space;
+				hudCache.Text(skp, x, y, "Relative yaw: {:.1f}", relYaw);
+				y += hudLayout.space;
 
 				double relPitch = atan2(relPos.y, sqrt(relPos.z * relPos.z + relPos.x * relPos.x)) * DEG;
-				buffer = std::format("Relative pitch: {:.1f}", relPitch);
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				hudCache.Text(skp, x, y, "Relative pitch: {:.1f}", relPitch);
 			}
 		}
 
 		void Astronaut::DrawCargoInfo(int x, int& y, oapi::Sketchpad* skp, const UACS::CargoInfo& cargoInfo, bool extraInfo)
 		{
-			if (extraInfo) buffer = std::format("Selected cargo name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
-			else buffer = std::format("Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
+			if (extraInfo) hudCache.Text(skp, x, y, "Selected cargo name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
+			else hudCache.Text(skp, x, y, "Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
 
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			y += hudLayout.space;
 
-			buffer = std::format("Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
-			skp->Text(x, y, buffer.c_str(), buffer.size());
-			y += hudInfo.space;
+			hudCache.Text(skp, x, y, "Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
+			y += hudLayout.space;
 
 			switch (cargoInfo.type)
 			{
@@ -1740,9 +1853,10 @@ namespace UACS
 
 				if (extraInfo)
 				{
-					y += hudInfo.space;
-					buffer = std::format("Breathable: {}", cargoInfo.breathable ? "Yes" : "No");
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					y += hudLayout.space;
+
+					if (cargoInfo.breathable) skp->Text(x, y, "Breathable: Yes", 15);
+					else skp->Text(x, y, "Breathable: No", 14);
 				}
 
 				break;
@@ -1750,83 +1864,105 @@ namespace UACS
 
 			if (cargoInfo.resource)
 			{
-				y += hudInfo.space;
-
-				buffer = *cargoInfo.resource;
-				buffer[0] = std::toupper(buffer[0]);
-				buffer.insert(0, "Resource: ");
+				y += hudLayout.space;
 
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				hudCache.Text(skp, x, y, "Resource: {}", UACS::Capitalized{ *cargoInfo.resource });
 			}
 		}
 
-		void Astronaut::SetVslMap()
+		void Astronaut::SetVslList()
 		{
-			hudInfo.vslMap.clear();
+			hudInfo.vslList.clear();
 
 			for (size_t idx{}; idx < oapiGetVesselCount(); ++idx)
 			{
 				if (OBJHANDLE hVessel = oapiGetVesselByIndex(idx); !mdlAPI.GetAstrInfoByHandle(hVessel) && !mdlAPI.GetCargoInfoByHandle(hVessel))
 				{
 					VECTOR3 pos; GetRelativePos(hVessel, pos);
-					if (length(pos) <= searchRange) hudInfo.vslMap.emplace(idx, hVessel);
+					if (length(pos) <= searchRange) hudInfo.vslList.emplace_back(idx, hVessel);
 				}
 			}
 		}
 
-		void Astronaut::SetAstrMap()
+		void Astronaut::SetAstrList()
 		{
-			hudInfo.astrMap.clear();
+			if (const size_t astrGen = mdlAPI.GetScnAstrGen(); astrGen != hudInfo.astrGen)
+			{
+				hudInfo.astrGen = astrGen;
+				hudInfo.scnAstrList.clear();
+
+				for (size_t idx{}; idx < GetScnAstrCount(); ++idx)
+					if (OBJHANDLE hAstr = GetAstrInfoByIndex(idx).first; hAstr != GetHandle()) hudInfo.scnAstrList.emplace_back(idx, hAstr);
+			}
 
-			for (size_t idx{}; idx < GetScnAstrCount(); ++idx)
+			hudInfo.astrList.clear();
+
+			for (const auto& [idx, hAstr] : hudInfo.scnAstrList)
 			{
-				if (OBJHANDLE hAstr = GetAstrInfoByIndex(idx).first; hAstr != GetHandle())
-				{
-					VECTOR3 pos; GetRelativePos(hAstr, pos);
-					if (length(pos) <= searchRange) hudInfo.astrMap.emplace(idx, hAstr);
-				}
+				VECTOR3 pos; GetRelativePos(hAstr, pos);
+				if (length(pos) <= searchRange) hudInfo.astrList.emplace_back(idx, hAstr);
 			}
 		}
 
-		void Astronaut::SetCargoMap()
+		void Astronaut::SetCargoList()
 		{
-			hudInfo.cargoMap.clear();
+			if (const size_t cargoGen = mdlAPI.GetScnCargoGen(); cargoGen != hudInfo.cargoGen)
+			{
+				hudInfo.cargoGen = cargoGen;
+				hudInfo.scnCargoList.clear();
 
-			for (size_t idx{}; idx < mdlAPI.GetScnCargoCount(); ++idx)
+				for (size_t idx{}; idx < mdlAPI.GetScnCargoCount(); ++idx) hudInfo.scnCargoList.emplace_back(idx, mdlAPI.GetCargoInfoByIndex(idx).handle);
+			}
+
+			hudInfo.cargoList.clear();
+
+			for (const auto& [idx, hCargo] : hudInfo.scnCargoList)
 			{
-				if (UACS::CargoInfo cargoInfo = mdlAPI.GetCargoInfoByIndex(idx); !cargoInfo.attached)
-				{
-					VECTOR3 pos; GetRelativePos(cargoInfo.handle, pos);
-					if (length(pos) <= searchRange) hudInfo.cargoMap.emplace(idx, cargoInfo.handle);
-				}
+				VECTOR3 pos; GetRelativePos(hCargo, pos);
+
+				// The indices are valid as long as the generation is unchanged. The attachment is only checked for cargoes in range
+				if (length(pos) <= searchRange && !mdlAPI.GetCargoInfoByIndex(idx).attached) hudInfo.cargoList.emplace_back(idx, hCargo);
 			}
 		}
 
-		void Astronaut::SetMapIdx(const std::map<size_t, OBJHANDLE>& map, bool increase)
+		bool Astronaut::SetListSelection(const HudInfo::HudList& list)
 		{
-			if (map.empty()) return;
+			// The selection is found by handle, so it's kept if the scenario indices change
+			if (hudInfo.hVessel)
+			{
+				auto it = std::ranges::find(list, hudInfo.hVessel, &HudInfo::HudList::value_type::second);
 
-			auto it = map.find(hudInfo.vslIdx);
+				if (it != list.end()) { hudInfo.vslIdx = it->first; return false; }
+			}
 
-			if (it == map.end()) return;
+			hudInfo.vslIdx = list.front().first;
+			hudInfo.hVessel = list.front().second;
+
+			return true;
+		}
+
+		void Astronaut::SetListIdx(const HudInfo::HudList& list, bool increase)
+		{
+			if (list.empty()) return;
+
+			auto it = std::ranges::find(list, hudInfo.hVessel, &HudInfo::HudList::value_type::second);
+
+			if (it == list.end()) return;
 
 			if (increase)
 			{
 				++it;
-				it = (it == map.end()) ? map.begin() : it;
-
-				hudInfo.vslIdx = it->first;
-				hudInfo.hVessel = it->second;
+				it = (it == list.end()) ? list.begin() : it;
 			}
 			else
 			{
-				it = (it == map.begin()) ? map.end() : it;
+				it = (it == list.begin()) ? list.end() : it;
 				--it;
-
-				hudInfo.vslIdx = it->first;
-				hudInfo.hVessel = it->second;
 			}
 
+			hudInfo.vslIdx = it->first;
+			hudInfo.hVessel = it->second;
+
 			hudInfo.vslInfo = HudInfo::VesselInfo();
 		}
 	}
@@ -1,9 +1,9 @@
 #pragma once
 #include "..\..\API\Astronaut.h"
 #include "..\..\API\Module.h"
+#include "..\..\HudCommon.h"
 #include <array>
 #include <forward_list>
-#include <map>
 
 namespace UACS
 {
@@ -28,6 +28,8 @@ namespace UACS
 			int clbkConsumeBufferedKey(DWORD key, bool down, char* kstate) override;
 			int clbkConsumeDirectKey(char* kstate) override;
 
+			void clbkOxygenDepleted() override;
+
 			void clbkPreStep(double simt, double simdt, double mjd) override;
 			bool clbkDrawHUD(int mode, const HUDPAINTSPEC* hps, oapi::Sketchpad* skp) override;
 
@@ -37,6 +39,12 @@ namespace UACS
 			inline static bool showMeshInCockpit{ true };
 			inline static bool enhancedMovements{ true };
 			inline static double searchRange{ 60e3 };
+			inline static double detailRange{ 1e3 };
+			inline static double hudRefreshRate{ 10 };
+
+			// Shared by all astronauts, and released with the last one
+			inline static oapi::Font* deadFont{};
+			inline static size_t deadFontUsers{};
 			static void LoadConfig();
 
 			UACS::AstrInfo astrInfo;
@@ -49,11 +57,16 @@ namespace UACS
 			PROPELLANT_HANDLE hFuel, hOxy;
 			std::array<TOUCHDOWNVTX, 13> tdVtx;
 
-			std::string buffer;
 			bool keyDown{};
 			bool suitOn{ true };
 			bool suitRead{};
 			double consumptionRate{ 1 };
+			double oxyMaxMass{};
+
+			// Landed idle astronauts without focus are updated every lodNearInterval seconds within detailRange of the focus object, and every lodFarInterval seconds beyond it
+			inline static const double lodNearInterval{ 0.5 };
+			inline static const double lodFarInterval{ 5 };
+			double lodTimer{};
 
 			double avgForce{};
 			size_t forceStep{};
@@ -73,7 +86,6 @@ namespace UACS
 			struct HudInfo
 			{
 				size_t mode{ HUD_NONE };
-				oapi::Font* deadFont{};
 
 				std::string message;
 				double timer{};
@@ -85,7 +97,13 @@ namespace UACS
 				OBJHANDLE hVessel{};
 				OBJHANDLE hVslAction{};
 
-				std::map<size_t, OBJHANDLE> vslMap, astrMap, cargoMap;
+				// Scenario indices and handles of the objects in range, sorted by index. Their capacity is kept between refreshes
+				using HudList = std::vector<std::pair<size_t, OBJHANDLE>>;
+				HudList vslList, astrList, cargoList;
+
+				// All the scenario astronauts and cargoes, only listed again when one is added or removed
+				HudList scnAstrList, scnCargoList;
+				std::optional<size_t> astrGen, cargoGen;
 
 				struct VesselInfo
 				{
@@ -96,9 +114,21 @@ namespace UACS
 					size_t actionIdx{};
 				} vslInfo;
 
-				int rightX, startY;
-				int smallSpace, space, largeSpace;
+				bool refresh{};
+				double refreshTime{};
+				bool showMessage{};
+				int startY{};
+
+				struct
+				{
+					size_t mode{ HUD_NONE };
+					int leftY{}, rightY{};
+				} shortPage;
 			} hudInfo{};
+			UACS::HudLayout hudLayout;
+			UACS::HudCache<24> hudCache;
+			UACS::HudRecorder<40> hudRecorder;
+			UACS::HudRecorder<24> shortRecorder;
 
 			struct
 			{
@@ -117,6 +147,16 @@ namespace UACS
 
 			double totalRunDist{};
 
+			// Walking to a target along the great circle, propagated from the start time so it's exact under any time acceleration
+			struct
+			{
+				bool active{};
+				double startTime{};
+				double startLng{}, startLat{};
+				double hdg{}, angle{};
+				double speed{};
+			} traverse{};
+
 			struct
 			{
 				VECTOR3 pos;
@@ -141,12 +181,15 @@ namespace UACS
 			}; std::forward_list<BeaconInfo> beacons;
 
 			void InitPropellant();
-			void SetOxygenConsumption(double simdt);
+			bool SkipStep(double& simdt);
+			void SetOxygenConsumption();
 			void SetLandedStatus();
 
 			void SetSurfaceRef();
 			void SetGroundMovement(double simdt);
 			void SetLngLatHdg(double distance, double hdgOffset, VESSELSTATUS2& status);
+			void StartTraverse();
+			void SetTraverse();
 
 			void SetDefaultValues();
 			void SetValue(ValueInfo& valueInfo, bool setMax, bool setMin, bool setSlow);
@@ -157,6 +200,7 @@ namespace UACS
 			void SetSuit(bool on, bool checkBreath);
 			void Kill(bool isLanded);
 
+			void SetHudModel();
 			void DrawNearHUD(int x, int y, oapi::Sketchpad* skp);
 			void DrawVslHUD(int x, int y, oapi::Sketchpad* skp);
 			void DrawAstrHUD(int x, int y, oapi::Sketchpad* skp);
@@ -167,10 +211,11 @@ namespace UACS
 			void DrawVslInfo(int x, int& y, oapi::Sketchpad* skp, VECTOR3 relPos);
 			void DrawCargoInfo(int x, int& y, oapi::Sketchpad* skp, const UACS::CargoInfo& cargoInfo, bool extraInfo);
 
-			void SetVslMap();
-			void SetAstrMap();
-			void SetCargoMap();
-			void SetMapIdx(const std::map<size_t, OBJHANDLE>& map, bool increase);
+			void SetVslList();
+			void SetAstrList();
+			void SetCargoList();
+			bool SetListSelection(const HudInfo::HudList& list);
+			void SetListIdx(const HudInfo::HudList& list, bool increase);
 		};
 	}
 }
\ No newline at end of file
@@ -2,9 +2,9 @@
 #include "Cargo.h"
 #include "..\..\BaseCommon.h"
 
-#include <sstream>
 #include <array>
 #include <filesystem>
+#include <limits>
 
 DLLCLBK VESSEL* ovcInit(OBJHANDLE hVessel, int fModel) { return new UACS::Vessel::Cargo(hVessel, fModel); }
 
@@ -118,17 +118,17 @@ namespace UACS
 
 			while (oapiReadScenario_nextline(scn, line))
 			{
-				std::istringstream ss(line);
-				std::string data;
+				UACS::ScenarioLine scnLine(line);
+				const std::string_view key = scnLine.Next();
 
 				bool read{};
 
-				if (ss >> data)
+				if (!key.empty())
 				{
-					if (read = data == "UNPACKED") ss >> cargoInfo.unpacked;
+					if (read = key == "UNPACKED") scnLine.Read(cargoInfo.unpacked);
 
 					if (cargoInfo.unpacked) SetUnpackedCaps(false);
-					else if (unpackMode == UnpackMode::DELAYED && (read = data == "UNPACK_TIMER")) ss >> unpackTimer;
+					else if (unpackMode == UnpackMode::DELAYED && (read = key == "UNPACK_TIMER")) scnLine.Read(unpackTimer);
 				}
 
 				if (!read) ParseScenarioLineEx(line, status);
@@ -144,11 +144,19 @@ namespace UACS
 			oapiWriteScenario_int(scn, "UNPACKED", cargoInfo.unpacked);
 
 			if (!cargoInfo.unpacked && unpackMode == UnpackMode::DELAYED && !GetAttachmentStatus(cargoInfo.hAttach))
-				oapiWriteScenario_float(scn, "UNPACK_TIMER", unpackTimer);
+				oapiWriteScenario_float(scn, "UNPACK_TIMER", sleeping ? unpackTimer + oapiGetSimTime() - sleepTime : unpackTimer);
 		}
 
 		void Cargo::clbkPreStep(double simt, double simdt, double mjd)
 		{
+			if (sleeping)
+			{
+				// Only leaving the ground or a due delayed unpacking wakes the cargo here. UACS callbacks wake it directly
+				if (GetFlightStatus() && simt < wakeTime) return;
+
+				Wake(simt - simdt);
+			}
+
 			if (!GetFlightStatus() && GroundContact())
 			{
 				VECTOR3 angAcc; GetAngularAcc(angAcc);
@@ -163,7 +171,7 @@ namespace UACS
 				}
 			}
 
-			if (cargoInfo.type != UACS::UNPACKABLE || cargoInfo.unpacked || unpackMode == UnpackMode::MANUAL) return;
+			if (cargoInfo.type != UACS::UNPACKABLE || cargoInfo.unpacked || unpackMode == UnpackMode::MANUAL) { SetSleep(simt); return; }
 
 			if (GetAttachmentStatus(cargoInfo.hAttach))
 			{
@@ -180,6 +188,7 @@ namespace UACS
 				case UnpackMode::DELAYED:
 					unpackTimer += simdt;
 					if (unpackTimer >= unpackDelay) { unpackTimer = 0; clbkUnpackCargo(); }
+					else SetSleep(simt);
 					break;
 
 				case UnpackMode::LANDED:
@@ -191,6 +200,10 @@ namespace UACS
 
 		const UACS::Cargo::CargoInfo* Cargo::clbkGetCargoInfo() { return &cargoInfo; }
 
+		void Cargo::clbkCargoGrappled() { Wake(oapiGetSimTime()); }
+
+		void Cargo::clbkCargoReleased() { Wake(oapiGetSimTime()); }
+
 		double Cargo::clbkDrainResource(double mass)
 		{
 			double fuelMass = GetFuelMass();
@@ -212,6 +225,8 @@ namespace UACS
 
 		bool Cargo::clbkPackCargo()
 		{
+			Wake(oapiGetSimTime());
+
 			cargoInfo.unpacked = false;
 
 			SetPackedCaps();
@@ -219,7 +234,28 @@ namespace UACS
 			return true;
 		}
 
-		bool Cargo::clbkUnpackCargo() { return UnpackCargo(); }
+		bool Cargo::clbkUnpackCargo() { Wake(oapiGetSimTime()); return UnpackCargo(); }
+
+		void Cargo::SetSleep(double simt)
+		{
+			if (!GetFlightStatus() || GetAttachmentStatus(cargoInfo.hAttach)) return;
+
+			sleeping = true;
+			sleepTime = simt;
+
+			const bool delayedUnpack = cargoInfo.type == UACS::UNPACKABLE && !cargoInfo.unpacked && unpackMode == UnpackMode::DELAYED;
+			wakeTime = delayedUnpack ? simt + unpackDelay - unpackTimer : std::numeric_limits<double>::infinity();
+		}
+
+		void Cargo::Wake(double simt)
+		{
+			if (!sleeping) return;
+
+			sleeping = false;
+
+			// Add the time slept, which wasn't counted by clbkPreStep
+			if (unpackMode == UnpackMode::DELAYED) unpackTimer += simt - sleepTime;
+		}
 
 		bool Cargo::UnpackCargo(bool firstUnpack)
 		{
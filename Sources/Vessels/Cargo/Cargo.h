@@ -20,6 +20,9 @@ namespace UACS
 			const UACS::Cargo::CargoInfo* clbkGetCargoInfo() override;
 			double clbkDrainResource(double mass) override;
 
+			void clbkCargoGrappled() override;
+			void clbkCargoReleased() override;
+
 			bool clbkPackCargo() override;
 			bool clbkUnpackCargo() override;
 
@@ -40,6 +43,9 @@ namespace UACS
 			int unpackDelay; double unpackTimer{};
 			int unpackedCount{ 1 };
 
+			bool sleeping{};
+			double sleepTime{}, wakeTime{};
+
 			std::string unpackVslName, unpackVslModule;
 			double unpackSize;
 
@@ -51,6 +57,9 @@ namespace UACS
 			std::optional<VECTOR3> unpackPMI;
 			std::optional<VECTOR3> unpackCS;
 
+			void SetSleep(double simt);
+			void Wake(double simt);
+
 			bool UnpackCargo(bool firstUnpack = true);
 			void SetPackedCaps(bool init = true);
 			void SetUnpackedCaps(bool init = true);
@@ -2,7 +2,6 @@
 
 #include <format>
 #include <array>
-#include <sstream>
 
 DLLCLBK VESSEL* ovcInit(OBJHANDLE hvessel, int flightmodel) { return new UACS::Vessel::Carrier(hvessel, flightmodel); }
 
@@ -213,10 +212,9 @@ namespace UACS
 
 			while (oapiReadScenario_nextline(scn, line)) 
 			{
-				std::istringstream ss(line);
-				std::string data;
+				UACS::ScenarioLine scnLine(line);
 
-				if (ss >> data && data == "HUD_MODE") ss >> hudMode;
+				if (scnLine.Next() == "HUD_MODE") scnLine.Read(hudMode);
 
 				else if (!mdlAPI.ParseScenarioLine(line)) ParseScenarioLineEx(line, status);
 			}
@@ -584,18 +582,24 @@ namespace UACS
 		{
 			VESSEL4::clbkDrawHUD(mode, hps, skp);
 
-			int x = HIWORD(skp->GetCharSize());
-			int rightX = hps->W - x;
-			int startY = int(0.215 * hps->H);
-			int y = startY;
+			// The shortcut page is static, so it's only laid out again if the layout changes
+			if (hudLayout.Set(hps, skp, 0.215))
+			{
+				shortRecorder.Clear();
+				DrawShortHUD(&shortRecorder);
+			}
+
+			hudCache.Begin();
+
+			int x = hudLayout.leftX;
+			int y = hudLayout.startY;
 
-			int space = LOWORD(skp->GetCharSize());
-			int largeSpace = int(1.5 * space);
+			const int space = hudLayout.space;
+			const int largeSpace = hudLayout.largeSpace;
 
 			if (hudMode == HUD_OP)
 			{
-				buffer = std::format("Selected available cargo: {}", mdlAPI.GetAvailCargoName(cargoHUD.idx));
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				hudCache.Text(skp, x, y, "Selected available cargo: {}", mdlAPI.GetAvailCargoName(cargoHUD.idx));
 
 				if (cargoHUD.timer < 5) { y += largeSpace; skp->Text(x, y, cargoHUD.msg.c_str(), cargoHUD.msg.size()); }
 
@@ -607,13 +611,11 @@ namespace UACS
 					skp->Text(x, y, "Grappled cargo information", 26);
 					y += largeSpace;
 
-					buffer = std::format("Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Name: {}", oapiGetVesselInterface(cargoInfo.handle)->GetName());
 
 					y += space;
 
-					buffer = std::format("Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Mass: {:g}kg", oapiGetMass(cargoInfo.handle));
 
 					y += space;
 
@@ -629,8 +631,8 @@ namespace UACS
 
 						y += space;
 
-						buffer = std::format("Breathable: {}", cargoInfo.breathable ? "Yes" : "No");
-						skp->Text(x, y, buffer.c_str(), buffer.size());
+						if (cargoInfo.breathable) skp->Text(x, y, "Breathable: Yes", 15);
+						else skp->Text(x, y, "Breathable: No", 14);
 
 						break;
 					}
@@ -639,20 +641,15 @@ namespace UACS
 					{
 						y += space;
 
-						buffer = *cargoInfo.resource;
-						buffer[0] = std::toupper(buffer[0]);
-
-						buffer = std::format("Resource: {}", buffer);
-						skp->Text(x, y, buffer.c_str(), buffer.size());
+						hudCache.Text(skp, x, y, "Resource: {}", UACS::Capitalized{ *cargoInfo.resource });
 					}
 				}
 
-				x = rightX;
-				y = startY;
+				x = hudLayout.rightX;
+				y = hudLayout.startY;
 				skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
-				buffer = std::format("Selected available astronaut: {}", mdlAPI.GetAvailAstrName(astrHUD.idx));
-				skp->Text(x, y, buffer.c_str(), buffer.size());
+				hudCache.Text(skp, x, y, "Selected available astronaut: {}", mdlAPI.GetAvailAstrName(astrHUD.idx));
 
 				if (astrHUD.timer < 5) { y += largeSpace; skp->Text(x, y, astrHUD.msg.c_str(), astrHUD.msg.size()); }
 
@@ -664,81 +661,78 @@ namespace UACS
 					skp->Text(x, y, "Onboard astronaut information", 29);
 					y += largeSpace;
 
-					buffer = std::format("Name: {}", astrInfo.name);
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Name: {}", astrInfo.name);
 					y += space;
 
-					buffer = astrInfo.role;
-					buffer[0] = std::toupper(buffer[0]);
-
-					buffer = std::format("Role: {}", buffer);
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Role: {}", UACS::Capitalized{ astrInfo.role });
 					y += space;
 
-					buffer = std::format("Mass: {:g}kg", astrInfo.mass);
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Mass: {:g}kg", astrInfo.mass);
 					y += largeSpace;
 
-					buffer = std::format("Fuel: {:g}%", astrInfo.fuelLvl * 100);
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Fuel: {:g}%", astrInfo.fuelLvl * 100);
 					y += space;
 
-					buffer = std::format("Oxygen: {:g}%", astrInfo.oxyLvl * 100);
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					hudCache.Text(skp, x, y, "Oxygen: {:g}%", astrInfo.oxyLvl * 100);
 					y += space;
 
-					buffer = std::format("Alive: {}", astrInfo.alive ? "Yes" : "No");
-					skp->Text(x, y, buffer.c_str(), buffer.size());
+					if (astrInfo.alive) skp->Text(x, y, "Alive: Yes", 10);
+					else skp->Text(x, y, "Alive: No", 9);
 				}
 			}
-			else if (hudMode == HUD_SRT)
-			{
-				skp->Text(x, y, "Alt + M: Cycle between custom HUD modes", 39);
-				y += largeSpace;
+			else if (hudMode == HUD_SRT) shortRecorder.Draw(skp);
 
-				skp->Text(x, y, "Alt + Numpad 6/4: Select next/previous available cargo", 54);
-				y += space;
+			return true;
+		}
 
-				skp->Text(x, y, "Left Alt + A: Add selected cargo", 32);
-				y += space;
+		void Carrier::DrawShortHUD(oapi::Sketchpad* skp)
+		{
+			int x = hudLayout.leftX;
+			int y = hudLayout.startY;
 
-				skp->Text(x, y, "Left Alt + G: Grapple nearest cargo", 35);
-				y += space;
+			skp->Text(x, y, "Alt + M: Cycle between custom HUD modes", 39);
+			y += hudLayout.largeSpace;
 
-				skp->Text(x, y, "Left Alt + R: Release grappled cargo", 36);
-				y += space;
+			skp->Text(x, y, "Alt + Numpad 6/4: Select next/previous available cargo", 54);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Left Alt + P: Pack nearest packable cargo", 41);
-				y += space;
+			skp->Text(x, y, "Left Alt + A: Add selected cargo", 32);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Left Alt + U: Unpack nearest unpackable cargo", 45);
-				y += space;
+			skp->Text(x, y, "Left Alt + G: Grapple nearest cargo", 35);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Left Alt + F: Drain resource from nearest source", 48);
-				y += space;
+			skp->Text(x, y, "Left Alt + R: Release grappled cargo", 36);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Left Alt + D: Delete grappled cargo", 35);
+			skp->Text(x, y, "Left Alt + P: Pack nearest packable cargo", 41);
+			y += hudLayout.space;
 
-				x = rightX;
-				y = startY;
-				skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+			skp->Text(x, y, "Left Alt + U: Unpack nearest unpackable cargo", 45);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Alt + Numpad 8/2: Select next/previous available astronaut", 58);
-				y += space;
+			skp->Text(x, y, "Left Alt + F: Drain resource from nearest source", 48);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Right Alt + A: Add selected astronaut", 37);
-				y += space;
+			skp->Text(x, y, "Left Alt + D: Delete grappled cargo", 35);
 
-				skp->Text(x, y, "Right Alt + E: Egress onboard astronaut", 39);
-				y += space;
+			x = hudLayout.rightX;
+			y = hudLayout.startY;
+			skp->SetTextAlign(oapi::Sketchpad::RIGHT);
 
-				skp->Text(x, y, "Right Alt + T: Transfer onboard astronaut", 41);
-				y += space;
+			skp->Text(x, y, "Alt + Numpad 8/2: Select next/previous available astronaut", 58);
+			y += hudLayout.space;
 
-				skp->Text(x, y, "Right Alt + D: Delete onboard astronaut", 39);
-			}
+			skp->Text(x, y, "Right Alt + A: Add selected astronaut", 37);
+			y += hudLayout.space;
 
-			return true;
+			skp->Text(x, y, "Right Alt + E: Egress onboard astronaut", 39);
+			y += hudLayout.space;
+
+			skp->Text(x, y, "Right Alt + T: Transfer onboard astronaut", 41);
+			y += hudLayout.space;
+
+			skp->Text(x, y, "Right Alt + D: Delete onboard astronaut", 39);
 		}
 
 		void Carrier::vlift(VESSEL* v, double aoa, double M, double Re, void* context, double* cl, double* cm, double* cd)
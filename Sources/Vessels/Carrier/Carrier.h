@@ -1,6 +1,7 @@
 #pragma once
 #include "../../BaseCommon.h"
 #include "../../API/Module.h"
+#include "../../HudCommon.h"
 
 namespace UACS
 {
@@ -36,7 +37,11 @@ namespace UACS
 				std::string msg;
 				double timer{ 5 };
 			} astrHUD, cargoHUD;
-			std::string buffer;
+			UACS::HudLayout hudLayout;
+			UACS::HudCache<10> hudCache;
+			UACS::HudRecorder<16> shortRecorder;
+
+			void DrawShortHUD(oapi::Sketchpad* skp);
 
 			static void vlift(VESSEL* v, double aoa, double M, double Re, void* context, double* cl, double* cm, double* cd);
 			static void hlift(VESSEL* v, double aoa, double M, double Re, void* context, double* cl, double* cm, double* cd);
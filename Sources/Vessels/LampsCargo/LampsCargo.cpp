@@ -1,7 +1,6 @@
 #include "LampsCargo.h"
 #include "../../BaseCommon.h"
 
-#include <sstream>
 #include <array>
 
 DLLCLBK VESSEL* ovcInit(OBJHANDLE hvessel, int flightmodel) { return new UACS::Vessel::LampsCargo(hvessel, flightmodel); }
@@ -37,12 +36,11 @@ namespace UACS
 
 			while (oapiReadScenario_nextline(scn, line))
 			{
-				std::istringstream ss{ line };
-				std::string data;
+				UACS::ScenarioLine scnLine(line);
 
-				if (ss >> data && data == "UNPACKED")
+				if (scnLine.Next() == "UNPACKED")
 				{
-					ss >> cargoInfo.unpacked;
+					scnLine.Read(cargoInfo.unpacked);
 					if (cargoInfo.unpacked) SetUnpackedCaps(false);
 				}
 				else ParseScenarioLineEx(line, status);